@@ -27,6 +27,9 @@ void WaitForDebugger() {
 static constexpr auto DEFAULT_INI_FILENAME = "gta-reversed.ini";
 
 #include "extensions/Configs/FastLoader.hpp"
+#include "extensions/Configs/Streaming.hpp"
+#include "extensions/Configs/Animation.hpp"
+#include "extensions/Configs/PathFind.hpp"
 
 void LoadConfigurations() {
     // Firstly load the INI into the memory.
@@ -34,6 +37,9 @@ void LoadConfigurations() {
 
     // Then load all specific configurations.
     g_FastLoaderConfig.Load();
+    g_StreamingConfig.Load();
+    g_AnimationConfig.Load();
+    g_PathFindConfig.Load();
     // ...
 }
 
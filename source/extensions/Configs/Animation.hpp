@@ -0,0 +1,17 @@
+#pragma once
+
+#include "extensions/Configuration.hpp"
+
+inline struct AnimationConfig {
+    INI_CONFIG_SECTION("Animation");
+
+    bool   ParallelClumpUpdate         = false; //< Interpolate the key-frames of the moving entities' clumps on multiple threads (See `RpAnimBlendClumpUpdateAnimationsParallel`). Clumps with anim callbacks are still updated one-by-one, and the clumps to update are collected beforehand, so the anim callbacks must not delete entities/clumps
+    uint32 UncompressedCacheMaxEntries = 50;    //< Max. number of animations kept uncompressed (See `CAnimManager::UncompressAnimation`)
+    uint32 UncompressedCacheBudgetKB   = 0;     //< Max. size of the uncompressed key-frames of the cached animations, 0 for no limit
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(ParallelClumpUpdate, false);
+        STORE_INI_CONFIG_VALUE(UncompressedCacheMaxEntries, 50u);
+        STORE_INI_CONFIG_VALUE(UncompressedCacheBudgetKB, 0u);
+    }
+} g_AnimationConfig{};
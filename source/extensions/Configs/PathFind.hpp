@@ -0,0 +1,16 @@
+#pragma once
+
+#include "extensions/Configuration.hpp"
+
+inline struct PathFindConfig {
+    INI_CONFIG_SECTION("PathFind");
+
+    bool UseAStar    = false; //< Search routes with A* instead of the vanilla bucketed search (See `CPathFind::DoPathSearchAStar`)
+    bool CacheRoutes = false; //< Reuse the routes of repeated searches between the same nodes (See `notsa::PathRouteCache`)
+                              //< Either of these enables our `CPathFind::DoPathSearch`, which is off by default, as it sometimes breaks `CTaskComplexFollowNodeRoute::ComputePathNodes`
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(UseAStar, false);
+        STORE_INI_CONFIG_VALUE(CacheRoutes, false);
+    }
+} g_PathFindConfig{};
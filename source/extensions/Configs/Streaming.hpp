@@ -0,0 +1,13 @@
+#pragma once
+
+#include "extensions/Configuration.hpp"
+
+inline struct StreamingConfig {
+    INI_CONFIG_SECTION("Streaming");
+
+    bool MapImgFiles = false; //< Copy models into the streaming buffer from memory-mapped IMG files, instead of having the stream thread read them (Needs quite a bit of address space)
+
+    void Load() {
+        STORE_INI_CONFIG_VALUE(MapImgFiles, false);
+    }
+} g_StreamingConfig{};
@@ -10,10 +10,11 @@ void CAnimBlendAssociation::InjectHooks() {
     RH_ScopedOverloadedInstall(Constructor1, "clump_hier", 0x4CEFC0, CAnimBlendAssociation*(CAnimBlendAssociation::*)(RpClump*, CAnimBlendHierarchy*));
     RH_ScopedOverloadedInstall(Constructor2, "blend", 0x4CF020, CAnimBlendAssociation*(CAnimBlendAssociation::*)(CAnimBlendAssociation&));
     RH_ScopedOverloadedInstall(Constructor3, "static_blend", 0x4CF080, CAnimBlendAssociation*(CAnimBlendAssociation::*)(CAnimBlendStaticAssociation&));
+    RH_ScopedInstall(Destructor, 0x4CECF0, {.locked = true}); // Locked, as `CAnimManager` counts the references to the hierarchies in these (See `CAnimManager::AddAnimHierarchyRef`)
 
-    RH_ScopedOverloadedInstall(Init, "0", 0x4CED50, void(CAnimBlendAssociation::*)(RpClump*, CAnimBlendHierarchy*));
-    RH_ScopedOverloadedInstall(Init, "1", 0x4CEE40, void(CAnimBlendAssociation::*)(CAnimBlendAssociation&));
-    RH_ScopedOverloadedInstall(Init, "2", 0x4CEEC0, void(CAnimBlendAssociation::*)(CAnimBlendStaticAssociation&));
+    RH_ScopedOverloadedInstall(Init, "0", 0x4CED50, void(CAnimBlendAssociation::*)(RpClump*, CAnimBlendHierarchy*), {.locked = true}); // -||-
+    RH_ScopedOverloadedInstall(Init, "1", 0x4CEE40, void(CAnimBlendAssociation::*)(CAnimBlendAssociation&), {.locked = true});          // -||-
+    RH_ScopedOverloadedInstall(Init, "2", 0x4CEEC0, void(CAnimBlendAssociation::*)(CAnimBlendStaticAssociation&), {.locked = true});    // -||-
     RH_ScopedInstall(Start, 0x4CEB70);
     RH_ScopedInstall(AllocateAnimBlendNodeArray, 0x4CE9F0);
     RH_ScopedInstall(FreeAnimBlendNodeArray, 0x4CEA40);
@@ -93,6 +94,9 @@ CAnimBlendAssociation::~CAnimBlendAssociation() {
     if (m_Flags & ANIMATION_REFERENCE_BLOCK) {
         CAnimManager::RemoveAnimBlockRef(m_BlendHier->m_nAnimBlockId);
     }
+    if (m_BlendHier) {
+        CAnimManager::RemoveAnimHierarchyRef(m_BlendHier); // NOTSA
+    }
 }
 
 float CAnimBlendAssociation::GetTimeProgress() const {
@@ -109,6 +113,7 @@ void CAnimBlendAssociation::Init(RpClump* clump, CAnimBlendHierarchy* animHierar
     }
 
     m_BlendHier = animHierarchy;
+    CAnimManager::AddAnimHierarchyRef(m_BlendHier); // NOTSA
     for (auto& seq : m_BlendHier->GetSequences()) {
         if (!seq.m_FramesNum) {
             continue;
@@ -126,6 +131,7 @@ void CAnimBlendAssociation::Init(RpClump* clump, CAnimBlendHierarchy* animHierar
 // 0x4CEE40
 void CAnimBlendAssociation::Init(CAnimBlendAssociation& assoc) {
     m_BlendHier     = assoc.m_BlendHier;
+    CAnimManager::AddAnimHierarchyRef(m_BlendHier); // NOTSA
     m_NumBlendNodes = assoc.m_NumBlendNodes;
     m_Flags         = assoc.m_Flags;
     m_AnimId        = assoc.m_AnimId;
@@ -140,6 +146,7 @@ void CAnimBlendAssociation::Init(CAnimBlendAssociation& assoc) {
 // 0x4CEEC0
 void CAnimBlendAssociation::Init(CAnimBlendStaticAssociation& assoc) {
     m_BlendHier     = assoc.m_BlendHier;
+    CAnimManager::AddAnimHierarchyRef(m_BlendHier); // NOTSA
     m_NumBlendNodes = assoc.m_NumBlendNodes;
     m_Flags         = assoc.m_Flags;
     m_AnimId        = assoc.m_AnimId;
@@ -231,5 +231,6 @@ private:
     CAnimBlendAssociation* Constructor1(RpClump* clump, CAnimBlendHierarchy* animHierarchy) { this->CAnimBlendAssociation::CAnimBlendAssociation(clump, animHierarchy); return this; }
     CAnimBlendAssociation* Constructor2(CAnimBlendAssociation& assoc) { this->CAnimBlendAssociation::CAnimBlendAssociation(assoc); return this; }
     CAnimBlendAssociation* Constructor3(CAnimBlendStaticAssociation& assoc) { this->CAnimBlendAssociation::CAnimBlendAssociation(assoc); return this; }
+    CAnimBlendAssociation* Destructor() { this->CAnimBlendAssociation::~CAnimBlendAssociation(); return this; }
 };
 VALIDATE_SIZE(CAnimBlendAssociation, 0x3C);
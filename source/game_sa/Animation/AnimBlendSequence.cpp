@@ -3,6 +3,11 @@
 #include "AnimBlendSequence.h"
 #include <reversiblebugfixes/Bugs.hpp>
 
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define NOTSA_ANIM_BLEND_SEQUENCE_SSE2
+#include <emmintrin.h>
+#endif
+
 void CAnimBlendSequence::InjectHooks() {
     RH_ScopedClass(CAnimBlendSequence);
     RH_ScopedCategory("Animation");
@@ -31,6 +36,43 @@ CAnimBlendSequence::~CAnimBlendSequence() {
     }
 }
 
+// NOTSA: Dequantize `n` compressed key-frames in bulk
+// The scales are applied with divisions (Same as `FixedFloat`'s conversion operator), so the results are bit-identical to converting them one-by-one
+template<typename From, typename To>
+static void UncompressKeyFrames(const From* in, To* out, size_t n) {
+    constexpr auto HasTranslation = std::is_same_v<From, KeyFrameTransCompressed>;
+
+    size_t i = 0;
+#ifdef NOTSA_ANIM_BLEND_SEQUENCE_SSE2
+    const auto rotScale = _mm_set1_ps(4096.f);
+    if constexpr (HasTranslation) {
+        // A compressed key-frame is exactly 8 `int16`s: [Rot.x, Rot.y, Rot.z, Rot.w, DeltaTime, Trans.x, Trans.y, Trans.z]
+        // and the members of the uncompressed key-frame are in the same order, so it's just 2 x 4 floats
+        const auto dtTransScale = _mm_setr_ps(60.f, 1024.f, 1024.f, 1024.f);
+        for (; i < n; i++) {
+            const auto v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+            const auto lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16); // Sign extend to int32
+            const auto hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+            _mm_storeu_ps(&out[i].Rot.x, _mm_div_ps(_mm_cvtepi32_ps(lo), rotScale));
+            _mm_storeu_ps(&out[i].DeltaTime, _mm_div_ps(_mm_cvtepi32_ps(hi), dtTransScale));
+        }
+    } else {
+        for (; i < n; i++) {
+            const auto v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&in[i].Rot));
+            _mm_storeu_ps(&out[i].Rot.x, _mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)), rotScale));
+            out[i].DeltaTime = in[i].DeltaTime;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        out[i].Rot       = in[i].Rot;
+        out[i].DeltaTime = in[i].DeltaTime;
+        if constexpr (HasTranslation) {
+            out[i].Trans = in[i].Trans;
+        }
+    }
+}
+
 template<typename From, typename To>
 bool CAnimBlendSequence::ConvertKeyFrames(byte* pDataBlock) {
     constexpr auto HasTranslation = requires{ To::Trans; };
@@ -47,11 +89,15 @@ bool CAnimBlendSequence::ConvertKeyFrames(byte* pDataBlock) {
 
     auto* inKF  = static_cast<From*>(m_Frames);
     auto* outKF = static_cast<To*>(outFrames);
-    for (auto i = m_FramesNum; i --> 0; inKF++, outKF++) {
-        outKF->Rot = inKF->Rot;
-        outKF->DeltaTime = inKF->DeltaTime;
-        if constexpr (HasTranslation) {
-            outKF->Trans = inKF->Trans;
+    if constexpr (std::is_same_v<To, KeyFrame> || std::is_same_v<To, KeyFrameTrans>) { // NOTSA: Uncompressing
+        UncompressKeyFrames(inKF, outKF, m_FramesNum);
+    } else {
+        for (auto i = m_FramesNum; i --> 0; inKF++, outKF++) {
+            outKF->Rot = inKF->Rot;
+            outKF->DeltaTime = inKF->DeltaTime;
+            if constexpr (HasTranslation) {
+                outKF->Trans = inKF->Trans;
+            }
         }
     }
 
@@ -7,10 +7,19 @@ Do not delete this comment block. Respect others' work!
 
 #include "StdInc.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <extensions/ci_string.hpp>
 
 #include "AnimManager.h"
 #include "AnimAssocDescriptions.h"
+#include "extensions/Configs/Animation.hpp"
+
+static std::unordered_map<const CAnimBlendHierarchy*, uint32> s_AnimHierarchyRefs{};      // NOTSA: Number of associations using a hierarchy
+static std::unordered_map<const CAnimBlendHierarchy*, size_t> s_CachedAnimHierarchySizes{}; // NOTSA: Uncompressed size of the hierarchies in `ms_AnimCache`
+static std::unordered_set<const CAnimBlendHierarchy*>         s_OverflownAnimHierarchies{}; // NOTSA: Uncompressed hierarchies that didn't fit into `ms_AnimCache`
+static std::unordered_set<const CAnimBlendHierarchy*>         s_UntrackedAnimHierarchies{}; // NOTSA: Hierarchies with associations that weren't counted in `s_AnimHierarchyRefs` - These are never evicted
 
 void CAnimManager::InjectHooks() {
     RH_ScopedClass(CAnimManager);
@@ -56,7 +65,7 @@ void CAnimManager::Initialise() {
     ms_numAnimations = 0;
     ms_numAnimBlocks = 0;
     ms_numAnimAssocDefinitions = 118; // ANIM_TOTAL_GROUPS aka NUM_ANIM_ASSOC_GROUPS
-    ms_AnimCache.Init(50);
+    ms_AnimCache.Init(std::max(1u, g_AnimationConfig.UncompressedCacheMaxEntries)); // NOTSA: Originally 50
     ReadAnimAssociationDefinitions();
     RegisterAnimBlock("ped");
 }
@@ -402,24 +411,59 @@ void CAnimManager::UncompressAnimation(CAnimBlendHierarchy* h) {
         }
     } else if (!h->IsUncompressed()) { // Need to uncompress?
         assert(!h->m_Link); // Sanity check
-        auto l = ms_AnimCache.Insert(h);
-        if (!l) { // No more free links? (This is totally normal as animations aren't compressed back unless the cache is full)
-            // Remove least recently used item
-            const auto llr = ms_AnimCache.GetTail();
-            llr->data->RemoveUncompressedData();
-
-            // TODO: If the anim is still in use this will corrupt the animation data, and (hopefully) hit the assert in `GetKeyFrame`!
-            //       There's currently no way for us to tell if the animation is in use, so there's no better solution for now.
-            RemoveFromUncompressedCache(llr->data);
-
-            // Now try again, this time it should succeed
-            VERIFY(l = ms_AnimCache.Insert(h));
-        }
-        h->m_Link = l;
+        ms_UncompressedCacheStats.NumMisses++;
+
+        // NOTSA: Originally the least recently used hierarchy was compressed back if there were no free links,
+        //        even if it was still in use (Which corrupted the animation). Now only unreferenced ones are evicted.
+        InsertIntoUncompressedCache(h);
         h->Uncompress();
     } else if (h->m_Link) { // Already uncompressed, mark as recently-used in cache
+        ms_UncompressedCacheStats.NumHits++;
         h->m_Link->Remove(); // Remove from current position
         ms_AnimCache.Insert(*h->m_Link); // Now re-insert at head
+    } else if (s_OverflownAnimHierarchies.contains(h)) { // NOTSA: Uncompressed, but didn't fit into the cache last time, try again
+        ms_UncompressedCacheStats.NumHits++;
+        InsertIntoUncompressedCache(h);
+    }
+}
+
+// NOTSA
+void CAnimManager::InsertIntoUncompressedCache(CAnimBlendHierarchy* h) {
+    size_t size{};
+    for (const auto& seq : h->GetSequences()) {
+        size += seq.GetDataSize(false);
+    }
+
+    MakeRoomInUncompressedCache(size);
+
+    if (const auto l = ms_AnimCache.Insert(h)) {
+        h->m_Link = l;
+        s_CachedAnimHierarchySizes[h] = size;
+        s_OverflownAnimHierarchies.erase(h);
+        ms_UncompressedCacheStats.NumBytes += size;
+    } else if (s_OverflownAnimHierarchies.insert(h).second) {
+        ms_UncompressedCacheStats.NumOverflows++;
+    }
+}
+
+// NOTSA: Compress back the least recently used unreferenced hierarchies until there's a free link,
+//        and (If there's a budget) the size of the cache with the new hierarchy is within the budget.
+//        The budget is a soft limit - If all cached hierarchies are referenced it will be exceeded.
+void CAnimManager::MakeRoomInUncompressedCache(size_t numBytesNeeded) {
+    const auto budget    = (size_t)g_AnimationConfig.UncompressedCacheBudgetKB * 1024;
+    const auto NeedsRoom = [&] {
+        return ms_AnimCache.freeListHead.next == &ms_AnimCache.freeListTail
+            || budget && ms_UncompressedCacheStats.NumBytes + numBytesNeeded > budget;
+    };
+    for (auto l = ms_AnimCache.GetTail(); l != &ms_AnimCache.GetHeadLink() && NeedsRoom();) {
+        const auto h = l->data;
+        l = l->prev; // `l` is freed below
+        if (IsAnimHierarchyReferenced(h) || s_UntrackedAnimHierarchies.contains(h)) {
+            continue;
+        }
+        h->RemoveUncompressedData();
+        RemoveFromUncompressedCache(h);
+        ms_UncompressedCacheStats.NumEvictions++;
     }
 }
 
@@ -429,7 +473,39 @@ void CAnimManager::RemoveFromUncompressedCache(CAnimBlendHierarchy* h) {
         assert(l->data == h);
         ms_AnimCache.Remove(l);
         h->m_Link = nullptr;
+
+        // NOTSA
+        if (const auto it = s_CachedAnimHierarchySizes.find(h); it != s_CachedAnimHierarchySizes.end()) {
+            ms_UncompressedCacheStats.NumBytes -= it->second;
+            s_CachedAnimHierarchySizes.erase(it);
+        }
     }
+    s_OverflownAnimHierarchies.erase(h); // NOTSA
+    s_UntrackedAnimHierarchies.erase(h); // NOTSA: Only reached for these once their sequences are removed (Eg.: The anim block is unloaded)
+}
+
+// NOTSA
+void CAnimManager::AddAnimHierarchyRef(const CAnimBlendHierarchy* h) {
+    s_AnimHierarchyRefs[h]++;
+}
+
+// NOTSA
+void CAnimManager::RemoveAnimHierarchyRef(const CAnimBlendHierarchy* h) {
+    const auto it = s_AnimHierarchyRefs.find(h);
+    if (it == s_AnimHierarchyRefs.end()) { // The association wasn't counted, so there may be others like it still using the hierarchy
+        if (s_UntrackedAnimHierarchies.insert(h).second) {
+            NOTSA_LOG_WARN("Association of an untracked anim hierarchy ({:#x}) released, it won't be evicted from the uncompressed cache", LOG_PTR(h));
+        }
+        return;
+    }
+    if (--it->second == 0) {
+        s_AnimHierarchyRefs.erase(it);
+    }
+}
+
+// NOTSA
+bool CAnimManager::IsAnimHierarchyReferenced(const CAnimBlendHierarchy* h) {
+    return s_AnimHierarchyRefs.contains(h);
 }
 
 // 0x4D4410
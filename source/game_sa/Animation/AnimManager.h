@@ -35,6 +35,19 @@ private:
 
     static inline CLinkList<CAnimBlendHierarchy*>& ms_AnimCache = *(CLinkList<CAnimBlendHierarchy*>*)0xB5EB20;
 
+public:
+    //! NOTSA: Statistics of the uncompressed animation cache (See `UncompressAnimation`)
+    struct UncompressedCacheStats {
+        uint32 NumHits{};      //!< Was already uncompressed
+        uint32 NumMisses{};    //!< Had to be uncompressed
+        uint32 NumEvictions{}; //!< Compressed back to make room for another one
+        uint32 NumOverflows{}; //!< Couldn't be cached (All cached hierarchies were referenced), so it was left uncompressed outside the cache
+        size_t NumBytes{};     //!< Total size of the uncompressed key-frames of the cached hierarchies
+    };
+
+private:
+    static inline UncompressedCacheStats ms_UncompressedCacheStats{}; // NOTSA
+
 public:
     static void InjectHooks();
 
@@ -81,6 +94,14 @@ public:
     static void RemoveAnimBlockRefWithoutDelete(int32 index);
     static void RemoveFromUncompressedCache(CAnimBlendHierarchy* hier);
 
+    //! NOTSA: Mark the hierarchy as used by an association - Referenced hierarchies are never evicted from the uncompressed cache
+    static void AddAnimHierarchyRef(const CAnimBlendHierarchy* hier);
+    static void RemoveAnimHierarchyRef(const CAnimBlendHierarchy* hier);
+    static bool IsAnimHierarchyReferenced(const CAnimBlendHierarchy* hier);
+
+    //! NOTSA
+    static const auto& GetUncompressedCacheStats() { return ms_UncompressedCacheStats; }
+
     /*!
      * @addr 0x4D41C0
      * 
@@ -115,6 +136,8 @@ private:
     static void LoadAnimFile_ANPK(RwStream* stream, const IFPSectionHeader& h, bool compress, const char (*uncompressedAnims)[32]);
     static void LoadAnimFile_ANP23(RwStream* stream, const IFPSectionHeader& h, bool compress, bool isANP3);
     static auto GetOrCreateAnimBlock(const char* name, uint32 numAnims);
+    static void InsertIntoUncompressedCache(CAnimBlendHierarchy* hier); // NOTSA
+    static void MakeRoomInUncompressedCache(size_t numBytesNeeded); // NOTSA
 };
 
 // 0x4C4DC0
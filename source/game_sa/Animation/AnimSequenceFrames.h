@@ -43,3 +43,9 @@ VALIDATE_SIZE(KeyFrameCompressed, 0xA);
 VALIDATE_SIZE(KeyFrameTransCompressed, 0x10);
 VALIDATE_SIZE(KeyFrame, 0x14);
 VALIDATE_SIZE(KeyFrameTrans, 0x20);
+
+// NOTSA: `UncompressKeyFrames` relies on these
+VALIDATE_OFFSET(KeyFrameTrans, DeltaTime, 0x10);
+VALIDATE_OFFSET(KeyFrameTrans, Trans, 0x14);
+VALIDATE_OFFSET(KeyFrameTransCompressed, DeltaTime, 0x8);
+VALIDATE_OFFSET(KeyFrameTransCompressed, Trans, 0xA);
@@ -4,6 +4,11 @@
 
 #include "AEStreamTransformer.h"
 
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define NOTSA_STREAM_TRANSFORMER_SSE2
+#include <immintrin.h>
+#endif
+
 CAEStreamTransformer& AEStreamTransformer = *(CAEStreamTransformer*)0xb612d8;
 
 // 0x4f1750
@@ -16,7 +21,29 @@ void CAEStreamTransformer::Initialise() {
 void CAEStreamTransformer::TransformBuffer(void* buffer, size_t size, uint32 position) {
     uint8* buf = reinterpret_cast<uint8*>(buffer);
 
-    for (size_t i = 0; i < size; i++)
+    size_t i = 0;
+#ifdef NOTSA_STREAM_TRANSFORMER_SSE2
+    if (size >= 16) {
+        // NOTSA: The key rotated by `position` - Byte `n` of it is the one used for byte `n` of every 16 byte block. (Repeated twice for AVX2)
+        alignas(32) uint8 key[32];
+        for (auto n = 0u; n < 16; n++) {
+            key[n] = key[n + 16] = table[(position + n) & 0xF];
+        }
+#ifdef __AVX2__
+        const auto key256 = _mm256_load_si256(reinterpret_cast<const __m256i*>(key));
+        for (; i + 32 <= size; i += 32) {
+            const auto p = reinterpret_cast<__m256i*>(buf + i);
+            _mm256_storeu_si256(p, _mm256_xor_si256(_mm256_loadu_si256(p), key256));
+        }
+#endif
+        const auto key128 = _mm_load_si128(reinterpret_cast<const __m128i*>(key));
+        for (; i + 16 <= size; i += 16) {
+            const auto p = reinterpret_cast<__m128i*>(buf + i);
+            _mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), key128));
+        }
+    }
+#endif
+    for (; i < size; i++)
         buf[i] ^= table[(position + i) & 0xF];
 }
 
@@ -1,5 +1,7 @@
 #include "StdInc.h"
 
+#include <atomic>
+
 HANDLE(&gStreamFileHandles)[MAX_CD_STREAM_HANDLES] = *(HANDLE(*)[MAX_CD_STREAM_HANDLES])0x8E4010;
 char(&gCdImageNames)[MAX_CD_STREAM_HANDLES][MAX_CD_STREAM_IMAGE_NAME_SIZE] = *(char(*)[MAX_CD_STREAM_HANDLES][MAX_CD_STREAM_IMAGE_NAME_SIZE])0x8E4098;
 uint32& gStreamFileCreateFlags = *(uint32*)0x8E3FE0;
@@ -15,6 +17,7 @@ DWORD& gStreamingThreadId = *(DWORD*)0x8E4000;
 uint32& gLastCdStreamPosn = *(uint32*)0x8E4898;
 
 #define APPLY_CD_STREAM_DEADLOCK_FIX 1
+#define APPLY_CD_STREAM_PARALLEL_READS 1 // NOTSA: Service every stream (channel) on its own thread, so their reads don't wait for each other
 
 #ifdef APPLY_CD_STREAM_DEADLOCK_FIX
 // thanks to http://forums.codeguru.com/showthread.php?175474-a-CCriticalSection-question
@@ -46,6 +49,22 @@ public:
 
 static CSync cdStreamThreadSync;
 #endif
+
+// NOTSA: Read-only views of the whole image files (See `CdStreamReadMapped`)
+struct CdStreamImageView {
+    uint8* Data{};
+    size_t Size{};
+    bool   Failed{}; // Mapping failed, don't try again
+};
+static std::array<CdStreamImageView, MAX_CD_STREAM_HANDLES> s_ImageViews{};
+
+#ifdef APPLY_CD_STREAM_PARALLEL_READS
+static std::vector<HANDLE> s_StreamRequestSemaphores{}; // Signaled by `CdStreamRead` for the stream of the same index
+static std::vector<HANDLE> s_StreamThreads{};           // Thread of the stream of the same index (`CdStreamWorkerThread`)
+static std::vector<HANDLE> s_StreamReadEvents{};        // `OVERLAPPED::hEvent` of the stream of the same index
+static std::atomic<bool>   s_StopStreamThreads{};       // Set by `CdStreamStopWorkerThreads` to make the stream threads exit
+static bool                s_UseStreamWorkerThreads{};  // If the threads above are used, otherwise (if they couldn't be created) `CdStreamThread` is
+#endif
 #include "AEBankLoader.h"
 
 void InjectCdStreamHooks() {
@@ -172,6 +191,13 @@ bool CdStreamRead(int32 streamId, void* lpBuffer, CdStreamPos pos, int32 sectorC
         stream.nSectorsToRead = sectorCount;
         stream.lpBuffer = lpBuffer;
         stream.bLocked = false;
+#ifdef APPLY_CD_STREAM_PARALLEL_READS
+        if (s_UseStreamWorkerThreads) {
+            if (!ReleaseSemaphore(s_StreamRequestSemaphores[streamId], 1, nullptr))
+                NOTSA_LOG_DEBUG("Signal Sema Error");
+            return true;
+        }
+#endif
         AddToQueue(&gStreamQueue, streamId);
         if (!ReleaseSemaphore(gStreamSemaphore, 1, nullptr))
             NOTSA_LOG_DEBUG("Signal Sema Error");
@@ -191,6 +217,46 @@ bool CdStreamRead(int32 streamId, void* lpBuffer, CdStreamPos pos, int32 sectorC
     return ReadFile(stream.hFile, lpBuffer, numberOfBytesToRead, &numberOfBytesRead, nullptr);
 }
 
+// NOTSA
+// Read the requested sectors of the stream into it's buffer.
+// The offset is passed in the `OVERLAPPED` struct (a positioned read, like `pread`), so the file pointer
+// is never touched, and multiple streams may read from the same file at the same time.
+static eCdStreamStatus CdStreamReadSectors(CdStream& stream) {
+    const DWORD numberOfBytesToRead = stream.nSectorsToRead * STREAMING_SECTOR_SIZE;
+    stream.overlapped.Offset = stream.nSectorOffset * STREAMING_SECTOR_SIZE;
+    stream.overlapped.OffsetHigh = 0;
+    if (!gOverlappedIO) { // Handle isn't overlapped, so `ReadFile` returns once done
+        DWORD numberOfBytesRead = 0;
+        return ReadFile(stream.hFile, stream.lpBuffer, numberOfBytesToRead, &numberOfBytesRead, &stream.overlapped)
+            ? eCdStreamStatus::READING_SUCCESS
+            : eCdStreamStatus::READING_FAILURE;
+    }
+    if (ReadFile(stream.hFile, stream.lpBuffer, numberOfBytesToRead, nullptr, &stream.overlapped)) {
+        return eCdStreamStatus::READING_SUCCESS;
+    }
+    if (GetLastError() != ERROR_IO_PENDING) {
+        return eCdStreamStatus::READING_FAILURE;
+    }
+    DWORD numberOfBytesTransferred = 0;
+    return GetOverlappedResult(stream.hFile, &stream.overlapped, &numberOfBytesTransferred, true)
+        ? eCdStreamStatus::READING_SUCCESS
+        : eCdStreamStatus::READING_FAILURE;
+}
+
+// NOTSA
+// Let `CdStreamSync` know the stream is done
+static void CdStreamFinishRead(CdStream& stream) {
+#ifdef APPLY_CD_STREAM_DEADLOCK_FIX
+    CLockGuard lockGuard(cdStreamThreadSync);
+#endif
+    // locking is necessary here, so ReleaseSemaphore is not called before WaitForSingleObject
+    // in CdStreamSync to avoid causing a deadlock.
+    stream.nSectorsToRead = 0;
+    if (stream.bLocked)
+        ReleaseSemaphore(stream.sync.hSemaphore, 1, nullptr);
+    stream.bInUse = false;
+}
+
 // 0x406560
 [[noreturn]] void WINAPI CdStreamThread(LPVOID lpParam) {
 #ifdef TRACY_ENABLE
@@ -206,43 +272,112 @@ bool CdStreamRead(int32 streamId, void* lpBuffer, CdStreamPos pos, int32 sectorC
         CdStream& stream = gCdStreams[streamId];
         stream.bInUse = true;
         if (stream.status == eCdStreamStatus::READING_SUCCESS) {
-            const DWORD numberOfBytesToRead = stream.nSectorsToRead * STREAMING_SECTOR_SIZE;
-            const DWORD overlappedOffset = stream.nSectorOffset * STREAMING_SECTOR_SIZE;
-            if (gOverlappedIO) {
-                stream.overlapped.Offset = overlappedOffset;
-                if (ReadFile(stream.hFile, stream.lpBuffer, numberOfBytesToRead, nullptr, &stream.overlapped)) {
-                    stream.status = eCdStreamStatus::READING_SUCCESS;
-                } else if (GetLastError() != ERROR_IO_PENDING) {
-                    stream.status = eCdStreamStatus::READING_FAILURE;
-                } else {
-                    DWORD numberOfBytesTransferred = 0;
-                    if (GetOverlappedResult(stream.hFile, &stream.overlapped, &numberOfBytesTransferred, true))
-                        stream.status = eCdStreamStatus::READING_SUCCESS;
-                    else
-                        stream.status = eCdStreamStatus::READING_FAILURE;
-                }
-            } else {
-                SetFilePointer(stream.hFile, overlappedOffset, nullptr, 0u);
-                DWORD numberOfBytesRead = 0;
-                if (ReadFile(stream.hFile, stream.lpBuffer, numberOfBytesToRead, &numberOfBytesRead, nullptr))
-                    stream.status = eCdStreamStatus::READING_SUCCESS;
-                else
-                    stream.status = eCdStreamStatus::READING_FAILURE;
-            }
+            stream.status = CdStreamReadSectors(stream);
         }
 
         RemoveFirstInQueue(&gStreamQueue);
-#ifdef APPLY_CD_STREAM_DEADLOCK_FIX
-        CLockGuard lockGuard(cdStreamThreadSync);
+        CdStreamFinishRead(stream);
+    }
+}
+
+#ifdef APPLY_CD_STREAM_PARALLEL_READS
+// NOTSA
+// Same as `CdStreamThread`, but only services the stream it was created for (`lpParam` is the stream's id)
+// Exits once `s_StopStreamThreads` is set (or if the semaphore can't be waited on)
+static DWORD WINAPI CdStreamWorkerThread(LPVOID lpParam) {
+    const auto streamId = (int32)(uintptr_t)lpParam;
+
+#ifdef TRACY_ENABLE
+    tracy::SetThreadName(std::format("CdStreamThread {}", streamId).c_str());
 #endif
-        // locking is necessary here, so ReleaseSemaphore is not called before WaitForSingleObject
-        // in CdStreamSync to avoid causing a deadlock.
-        stream.nSectorsToRead = 0;
-        if (stream.bLocked)
-            ReleaseSemaphore(stream.sync.hSemaphore, 1, nullptr);
-        stream.bInUse = false;
+
+    CdStream& stream = gCdStreams[streamId];
+    while (true) {
+        if (WaitForSingleObject(s_StreamRequestSemaphores[streamId], INFINITE) != WAIT_OBJECT_0 || s_StopStreamThreads) {
+            return 0;
+        }
+
+        ZoneScoped;
+
+        stream.bInUse = true;
+        if (stream.status == eCdStreamStatus::READING_SUCCESS) {
+            stream.status = CdStreamReadSectors(stream);
+        }
+        CdStreamFinishRead(stream);
     }
 }
+#endif
+
+#ifdef APPLY_CD_STREAM_PARALLEL_READS
+// NOTSA
+// Make the stream threads exit, wait for them (They may be in the middle of a read), and free everything they use
+static void CdStreamStopWorkerThreads() {
+    s_StopStreamThreads = true;
+    for (auto h : s_StreamRequestSemaphores) {
+        if (h) {
+            ReleaseSemaphore(h, 1, nullptr);
+        }
+    }
+    for (auto h : s_StreamThreads) {
+        if (h) {
+            WaitForSingleObject(h, INFINITE);
+        }
+    }
+    for (auto& handles : { &s_StreamRequestSemaphores, &s_StreamThreads, &s_StreamReadEvents }) {
+        for (auto h : *handles) {
+            if (h) {
+                CloseHandle(h);
+            }
+        }
+        handles->clear();
+    }
+    for (auto& stream : std::span{ gCdStreams, (size_t)gStreamCount }) {
+        stream.overlapped.hEvent = nullptr;
+    }
+}
+
+// NOTSA
+// Each stream gets its own request semaphore, read event and thread, so that all of them may be reading at once.
+// (With a single thread the 2nd channel has to wait for the 1st one's read to finish)
+// The read event is necessary, because with multiple reads pending on the same file, the file's handle
+// can't be used to tell which one has finished.
+// Returns false (with everything created so far freed) if any of them couldn't be created
+static bool CdStreamInitWorkerThreads() {
+    s_StopStreamThreads = false;
+
+    // Sized up-front, so that the threads can index them while the rest are being created
+    s_StreamRequestSemaphores.assign(gStreamCount, nullptr);
+    s_StreamReadEvents.assign(gStreamCount, nullptr);
+    s_StreamThreads.assign(gStreamCount, nullptr);
+
+    for (auto&& [streamId, stream] : rngv::enumerate(std::span{ gCdStreams, (size_t)gStreamCount })) {
+        s_StreamRequestSemaphores[streamId] = OS_SemaphoreCreate(5, nullptr);
+        if (!s_StreamRequestSemaphores[streamId]) {
+            NOTSA_LOG_DEBUG("cdvd_stream: failed to create stream semaphore");
+            CdStreamStopWorkerThreads();
+            return false;
+        }
+
+        s_StreamReadEvents[streamId] = stream.overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+        if (!stream.overlapped.hEvent) { // Without it reads on the same file couldn't be told apart
+            NOTSA_LOG_DEBUG("cdvd_stream: failed to create stream read event");
+            CdStreamStopWorkerThreads();
+            return false;
+        }
+
+        HANDLE hThread = CreateThread(nullptr, 0x10000, (LPTHREAD_START_ROUTINE)CdStreamWorkerThread, (LPVOID)(uintptr_t)streamId, CREATE_SUSPENDED, nullptr);
+        if (!hThread) {
+            NOTSA_LOG_DEBUG("cdvd_stream: failed to create streaming thread");
+            CdStreamStopWorkerThreads();
+            return false;
+        }
+        s_StreamThreads[streamId] = hThread;
+        SetThreadPriority(hThread, GetThreadPriority(GetCurrentThread()));
+        ResumeThread(hThread);
+    }
+    return true;
+}
+#endif
 
 // 0x4068F0
 void CdStreamInitThread() {
@@ -255,6 +390,13 @@ void CdStreamInitThread() {
             return;
         }
     }
+#ifdef APPLY_CD_STREAM_PARALLEL_READS
+    s_UseStreamWorkerThreads = CdStreamInitWorkerThreads();
+    if (s_UseStreamWorkerThreads) {
+        return;
+    }
+    NOTSA_LOG_DEBUG("cdvd_stream: falling back to a single streaming thread");
+#endif
     InitialiseQueue(&gStreamQueue, gStreamCount + 1);
     gStreamSemaphore = OS_SemaphoreCreate(5, "CdStream");
     if (gStreamSemaphore) {
@@ -313,6 +455,7 @@ void CdStreamRemoveImages() {
     for (int32 i = 0; i < gStreamCount; ++i) {
         CdStreamSync(i);
     }
+    CdStreamUnmapImages(); // NOTSA
     for (int32 i = 0; i < gOpenStreamCount; i++) {
         SetLastError(NO_ERROR);
         if (gStreamFileHandles[i]) {
@@ -327,16 +470,88 @@ void CdStreamRemoveImages() {
 // 0x406370
 void CdStreamShutdown() {
     if (gStreamingInitialized) {
-        FinalizeQueue(&gStreamQueue);
-        CloseHandle(gStreamSemaphore);
-        CloseHandle(gStreamingThread);
+#ifdef APPLY_CD_STREAM_PARALLEL_READS
+        if (std::exchange(s_UseStreamWorkerThreads, false)) {
+            CdStreamStopWorkerThreads();
+        } else
+#endif
+        {
+            FinalizeQueue(&gStreamQueue);
+            CloseHandle(gStreamSemaphore);
+            CloseHandle(gStreamingThread);
+        }
         for (auto& stream : std::span{ gCdStreams, (size_t)gStreamCount }) {
             CloseHandle(stream.sync.hSemaphore);
         }
     }
+    CdStreamUnmapImages(); // NOTSA
     LocalFree(gCdStreams);
 }
 
+// NOTSA
+// Get the contents of an image file mapped into memory (The file is mapped on first use)
+// The view is read-only, the data has to be copied out of it (See `CdStreamReadMapped`) before anything may be modified.
+// Returns an empty span if the file couldn't be mapped (eg.: not enough address space)
+static std::span<const uint8> CdStreamGetMappedImage(uint32 fileId) {
+    auto& view = s_ImageViews[fileId];
+    if (!view.Data && !view.Failed) {
+        view.Failed = true;
+
+        const auto hFile = gStreamFileHandles[fileId];
+        LARGE_INTEGER fileSize{};
+        if (!hFile || !GetFileSizeEx(hFile, &fileSize) || !fileSize.QuadPart || (uint64)fileSize.QuadPart > SIZE_MAX) {
+            return {};
+        }
+        const auto hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!hMapping) {
+            NOTSA_LOG_DEBUG("cdvd_stream: failed to create file mapping of {}", gCdImageNames[fileId]);
+            return {};
+        }
+        view.Data = (uint8*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(hMapping); // The view keeps the mapping alive
+        if (!view.Data) {
+            NOTSA_LOG_DEBUG("cdvd_stream: failed to map {}", gCdImageNames[fileId]);
+            return {};
+        }
+        view.Size = (size_t)fileSize.QuadPart;
+        view.Failed = false;
+    }
+    return { view.Data, view.Size };
+}
+
+// NOTSA
+// Same as `CdStreamRead`, but copies the sectors out of the mapped image file right away, instead of having the stream thread read them.
+// Each load gets its own copy in `lpBuffer`, so loaders may modify the data just like with `CdStreamRead`.
+// Once this returns true the stream is done (`CdStreamGetStatus` reports `READING_SUCCESS`).
+// Returns false (without touching the stream) if the stream is busy, or the file couldn't be mapped, in which case `CdStreamRead` has to be used.
+bool CdStreamReadMapped(int32 streamId, void* lpBuffer, CdStreamPos pos, int32 sectorCount) {
+    CdStream& stream = gCdStreams[streamId];
+    if (!gStreamingInitialized || stream.nSectorsToRead || stream.bInUse) {
+        return false;
+    }
+    const auto img = CdStreamGetMappedImage(pos.FileID);
+    const auto begin = (size_t)pos.Offset * STREAMING_SECTOR_SIZE, size = (size_t)sectorCount * STREAMING_SECTOR_SIZE;
+    if (img.empty() || begin + size > img.size()) { // Not mapped, or a broken directory entry
+        return false;
+    }
+    memcpy(lpBuffer, &img[begin], size);
+    gLastCdStreamPosn = sectorCount + (notsa::IsFixBugs() ? pos.Offset : pos.ToInt()); // CD_STREAM_READ_POS_FIX
+    stream.hFile = gStreamFileHandles[pos.FileID];
+    stream.status = eCdStreamStatus::READING_SUCCESS;
+    return true;
+}
+
+// NOTSA
+// Unmap all image files mapped by `CdStreamReadMapped`
+void CdStreamUnmapImages() {
+    for (auto& view : s_ImageViews) {
+        if (view.Data) {
+            UnmapViewOfFile(view.Data);
+        }
+        view = {};
+    }
+}
+
 uint32 CdStreamHandleToFileID(CdStreamHandle h) {
     return h >> CD_STREAM_HANDLE_BITS;
 }
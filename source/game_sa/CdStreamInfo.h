@@ -97,3 +97,5 @@ void CdStreamInitThread();
 void CdStreamInit(int32 streamCount);
 void CdStreamRemoveImages();
 void CdStreamShutdown();
+bool CdStreamReadMapped(int32 streamId, void* lpBuffer, CdStreamPos pos, int32 sectorCount);
+void CdStreamUnmapImages();
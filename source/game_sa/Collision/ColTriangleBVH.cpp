@@ -0,0 +1,223 @@
+#include "StdInc.h"
+
+#include "ColTriangleBVH.h"
+
+namespace notsa {
+static std::unordered_map<const CColTrianglePlane*, ColTriangleBVH> s_TriangleBVHs{}; // Triangle planes -> BVH of their triangles
+
+// Node bounds are grown by this much when testing them, because the
+// triangle planes (used by the narrow phase) aren't exactly on the vertices.
+constexpr float NODE_BOUNDS_PADDING = 0.25f;
+
+static int32 GetComponent(const CompressedVector& v, uint32 axis) {
+    switch (axis) {
+    case 0:  return v.x;
+    case 1:  return v.y;
+    default: return v.z;
+    }
+}
+
+static auto GetNodeBounds(const ColTriangleBVH::Node& node) {
+    const CVector pad{ NODE_BOUNDS_PADDING, NODE_BOUNDS_PADDING, NODE_BOUNDS_PADDING };
+    return std::make_pair(UncompressVector(node.Min) - pad, UncompressVector(node.Max) + pad);
+}
+
+void ColTriangleBVH::Build(const CCollisionData& cd) {
+    if (!cd.m_pTrianglePlanes) {
+        return;
+    }
+    if (cd.m_nNumTriangles < MIN_TRIS) {
+        s_TriangleBVHs.erase(cd.m_pTrianglePlanes); // Planes freed by unhooked code may have had one
+        return;
+    }
+    s_TriangleBVHs[cd.m_pTrianglePlanes].BuildFrom(cd);
+}
+
+void ColTriangleBVH::Remove(const CCollisionData& cd) {
+    if (cd.m_pTrianglePlanes) {
+        s_TriangleBVHs.erase(cd.m_pTrianglePlanes);
+    }
+}
+
+const ColTriangleBVH* ColTriangleBVH::Get(const CCollisionData& cd) {
+    if (cd.m_nNumTriangles < MIN_TRIS || !cd.m_pTrianglePlanes) {
+        return nullptr;
+    }
+    const auto it = s_TriangleBVHs.find(cd.m_pTrianglePlanes);
+    if (it == s_TriangleBVHs.end()) {
+        return nullptr;
+    }
+    const auto& bvh = it->second;
+    if (bvh.m_Tris != cd.m_pTriangles || bvh.m_Verts != cd.m_pVertices || bvh.m_NumTris != cd.m_nNumTriangles) { // Stale, the planes were (re)allocated by unhooked code
+        return nullptr;
+    }
+    return &bvh;
+}
+
+uint32 ColTriangleBVH::GetNumTrianglesPassing(bool doSeeThroughCheck, bool doShootThroughCheck) const {
+    uint32 numFailing{};
+    if (doSeeThroughCheck) {
+        numFailing += m_NumSeeThroughTris;
+    }
+    if (doShootThroughCheck) {
+        numFailing += m_NumShootThroughTris;
+    }
+    if (doSeeThroughCheck && doShootThroughCheck) {
+        numFailing -= m_NumSeeAndShootThroughTris; // Counted twice above
+    }
+    return m_NumTris - numFailing;
+}
+
+void ColTriangleBVH::FindTrianglesTouchingLine(const CColLine& line, std::pmr::vector<uint16>& out) const {
+    const auto& s = line.m_vecStart;
+    const auto  d = line.m_vecEnd - line.m_vecStart;
+    return FindTriangles([&](const Node& node) {
+        const auto [min, max] = GetNodeBounds(node);
+
+        // Slab test, `t` is the position on the line [0, 1]
+        float tMin = 0.f, tMax = 1.f;
+        for (auto axis = 0u; axis < 3; axis++) {
+            if (std::abs(d[axis]) < FLT_EPSILON) { // Parallel to the slab
+                if (s[axis] < min[axis] || s[axis] > max[axis]) {
+                    return false;
+                }
+                continue;
+            }
+            const auto invD = 1.f / d[axis];
+            auto t0 = (min[axis] - s[axis]) * invD;
+            auto t1 = (max[axis] - s[axis]) * invD;
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+            if (tMin > tMax) {
+                return false;
+            }
+        }
+        return true;
+    }, out);
+}
+
+void ColTriangleBVH::FindTrianglesTouchingSphere(const CSphere& sphere, std::pmr::vector<uint16>& out) const {
+    return FindTriangles([&](const Node& node) {
+        const auto [min, max] = GetNodeBounds(node);
+
+        float distSq{};
+        for (auto axis = 0u; axis < 3; axis++) {
+            const auto c = sphere.m_vecCenter[axis];
+            if (c < min[axis]) {
+                distSq += sq(min[axis] - c);
+            } else if (c > max[axis]) {
+                distSq += sq(c - max[axis]);
+            }
+        }
+        return distSq <= sq(sphere.m_fRadius);
+    }, out);
+}
+
+template<typename Pred>
+void ColTriangleBVH::FindTriangles(Pred&& IsNodeTouched, std::pmr::vector<uint16>& out) const {
+    const auto first = out.size();
+
+    // Median splits keep the tree shallow (~log2(UINT16_MAX / MAX_LEAF_TRIS)), and at most 2 nodes are pushed per level
+    uint32 stack[64];
+    size_t stackSize{};
+    stack[stackSize++] = 0;
+    while (stackSize) {
+        const auto  nodeIdx = stack[--stackSize];
+        const auto& node    = m_Nodes[nodeIdx];
+        if (!IsNodeTouched(node)) {
+            continue;
+        }
+        if (node.NumTris) {
+            const auto tris = std::span{ m_TriIdxs }.subspan(node.Idx, node.NumTris);
+            out.insert(out.end(), tris.begin(), tris.end());
+        } else {
+            assert(stackSize + 2 <= std::size(stack));
+            stack[stackSize++] = node.Idx;
+            stack[stackSize++] = nodeIdx + 1;
+        }
+    }
+    std::sort(out.begin() + first, out.end());
+}
+
+void ColTriangleBVH::BuildFrom(const CCollisionData& cd) {
+    m_Tris    = cd.m_pTriangles;
+    m_Verts   = cd.m_pVertices;
+    m_NumTris = cd.m_nNumTriangles;
+
+    m_NumSeeThroughTris = m_NumShootThroughTris = m_NumSeeAndShootThroughTris = 0;
+    for (const auto& tri : std::span{ cd.m_pTriangles, m_NumTris }) {
+        const auto isSeeThrough = g_surfaceInfos.IsSeeThrough(tri.m_nMaterial), isShootThrough = g_surfaceInfos.IsShootThrough(tri.m_nMaterial);
+        m_NumSeeThroughTris += isSeeThrough;
+        m_NumShootThroughTris += isShootThrough;
+        m_NumSeeAndShootThroughTris += isSeeThrough && isShootThrough;
+    }
+
+    m_TriIdxs.resize(m_NumTris);
+    std::iota(m_TriIdxs.begin(), m_TriIdxs.end(), (uint16)0);
+
+    m_Nodes.clear();
+    m_Nodes.reserve(2 * (m_NumTris / MAX_LEAF_TRIS + 1));
+    BuildNode(cd, 0, m_NumTris);
+}
+
+uint32 ColTriangleBVH::BuildNode(const CCollisionData& cd, uint32 first, uint32 count) {
+    const auto GetCentroidOnAxis = [&](uint16 triIdx, uint32 axis) { // Times 3, but that doesn't matter for comparisons
+        const auto& tri = cd.m_pTriangles[triIdx];
+        const auto  Get = [&](uint16 vertIdx) { return GetComponent(cd.m_pVertices[vertIdx], axis); };
+        return Get(tri.vA) + Get(tri.vB) + Get(tri.vC);
+    };
+
+    const auto tris = std::span{ m_TriIdxs }.subspan(first, count);
+
+    // Calculate bounds of the triangles and their centroids
+    std::array<int32, 3> min{ INT32_MAX, INT32_MAX, INT32_MAX }, max{ INT32_MIN, INT32_MIN, INT32_MIN };
+    std::array<int32, 3> cmin{ min }, cmax{ max };
+    for (const auto triIdx : tris) {
+        for (const auto vertIdx : cd.m_pTriangles[triIdx].m_vertIndices) {
+            const auto& v = cd.m_pVertices[vertIdx];
+            for (auto axis = 0u; axis < 3; axis++) {
+                const auto c = GetComponent(v, axis);
+                min[axis] = std::min(min[axis], c);
+                max[axis] = std::max(max[axis], c);
+            }
+        }
+        for (auto axis = 0u; axis < 3; axis++) {
+            const auto c = GetCentroidOnAxis(triIdx, axis);
+            cmin[axis] = std::min(cmin[axis], c);
+            cmax[axis] = std::max(cmax[axis], c);
+        }
+    }
+
+    const auto nodeIdx = (uint32)m_Nodes.size();
+    m_Nodes.push_back(Node{
+        .Min = { (int16)min[0], (int16)min[1], (int16)min[2] },
+        .Max = { (int16)max[0], (int16)max[1], (int16)max[2] },
+    });
+
+    // Split along the axis the centroids are spread the most on
+    uint32 axis = 0;
+    for (auto a = 1u; a < 3; a++) {
+        if (cmax[a] - cmin[a] > cmax[axis] - cmin[axis]) {
+            axis = a;
+        }
+    }
+    if (count <= MAX_LEAF_TRIS || cmax[axis] == cmin[axis]) { // Make it a leaf if there are few triangles, or they can't be split
+        m_Nodes[nodeIdx].NumTris = (uint16)count;
+        m_Nodes[nodeIdx].Idx     = first;
+        return nodeIdx;
+    }
+
+    // Split in half at the median
+    const auto half = count / 2;
+    rng::nth_element(tris, tris.begin() + half, {}, [&](uint16 triIdx) { return GetCentroidOnAxis(triIdx, axis); });
+
+    BuildNode(cd, first, half);                                           // 1st child is right after this node
+    const auto secondIdx = BuildNode(cd, first + half, count - half);
+    m_Nodes[nodeIdx].Idx = secondIdx;                                     // NB: Don't hold on to a reference, as the vector might've been reallocated
+
+    return nodeIdx;
+}
+}; // namespace notsa
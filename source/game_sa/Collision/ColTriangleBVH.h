@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+
+#include "CompressedVector.h"
+
+class CCollisionData;
+class CColLine;
+class CSphere;
+
+namespace notsa {
+/*!
+* @brief NOTSA - Bounding volume hierarchy of the triangles of a `CCollisionData`, used to quickly find the triangles a line/sphere may touch.
+*
+* @brief Nodes are stored in a flat array in depth-first order (The 1st child of an inner node is right after it),
+* @brief their bounds use the same compressed format as the vertices, so they're exact and small.
+* @brief They share the lifetime of the triangle planes: Built when the planes are (`CCollisionData::CalculateTrianglePlanes`),
+* @brief and freed when they're (`CCollisionData::RemoveTrianglePlanes`), keyed by the planes' address.
+* @brief Planes allocated by unhooked code have no BVH (Or a stale one, which is caught by checking the triangles/vertices), their triangles are just checked one-by-one.
+*/
+class ColTriangleBVH {
+public:
+    struct Node {
+        CompressedVector Min{}, Max{}; //!< Bounds of the node's triangles
+        uint16           NumTris{};    //!< No. of triangles if it's a leaf, 0 otherwise
+        uint32           Idx{};        //!< Leaf: Index of the first triangle in `m_TriIdxs` - Inner node: Index of the 2nd child
+    };
+
+    //! Models with less triangles are faster to go through one-by-one
+    static constexpr uint16 MIN_TRIS = 32;
+
+    //! Max no. of triangles in a leaf
+    static constexpr uint16 MAX_LEAF_TRIS = 4;
+
+public:
+    /*!
+    * @brief Build the BVH of the collision data (If it has enough triangles) - Must be called right after its triangle planes were calculated
+    */
+    static void Build(const CCollisionData& cd);
+
+    /*!
+    * @brief Free the BVH of the collision data (if any) - Must be called right before its triangle planes are freed
+    */
+    static void Remove(const CCollisionData& cd);
+
+    /*!
+    * @brief Get the BVH of the collision data
+    * @return The BVH, or null if the data has too few triangles or no triangle planes (In which case they should just be checked one-by-one)
+    */
+    static const ColTriangleBVH* Get(const CCollisionData& cd);
+
+    /*!
+    * @brief Find the triangles whose bounds the line (In object space) touches
+    * @param out Indices of the triangles are added to this in ascending order (So they're processed in the same order as without the BVH)
+    */
+    void FindTrianglesTouchingLine(const CColLine& line, std::pmr::vector<uint16>& out) const;
+
+    /*!
+    * @brief Find the triangles whose bounds the sphere (In object space) touches
+    * @copydoc FindTrianglesTouchingLine
+    */
+    void FindTrianglesTouchingSphere(const CSphere& sphere, std::pmr::vector<uint16>& out) const;
+
+    /*!
+    * @brief Get the no. of triangles (Of all) whose surface passes the see-through/shoot-through checks (See `CCollision::ProcessLineOfSight`)
+    */
+    uint32 GetNumTrianglesPassing(bool doSeeThroughCheck, bool doShootThroughCheck) const;
+
+private:
+    void     BuildFrom(const CCollisionData& cd);
+    uint32   BuildNode(const CCollisionData& cd, uint32 first, uint32 count);
+
+    template<typename Pred>
+    void FindTriangles(Pred&& IsNodeTouched, std::pmr::vector<uint16>& out) const;
+
+private:
+    // To make sure the data hasn't changed since the BVH was built
+    const void*         m_Tris{};
+    const void*         m_Verts{};
+    uint16              m_NumTris{};
+
+    // No. of triangles with surfaces that are see-through, shoot-through, and both
+    uint16              m_NumSeeThroughTris{}, m_NumShootThroughTris{}, m_NumSeeAndShootThroughTris{};
+
+    std::vector<Node>   m_Nodes{};
+    std::vector<uint16> m_TriIdxs{}; //!< Triangle indices, leaf nodes reference ranges of it
+};
+}; // namespace notsa
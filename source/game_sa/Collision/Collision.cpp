@@ -12,6 +12,7 @@
 
 #include "Collision.h"
 #include "ColHelpers.h"
+#include "ColTriangleBVH.h"
 #include "PedModelInfo.h"
 #include "TaskSimpleHoldEntity.h"
 
@@ -95,6 +96,34 @@ void CCollision::RemoveTrianglePlanes(CCollisionData* colData) {
     colData->RemoveTrianglePlanes();
 }
 
+// NOTSA
+// Call `fn` with the index of all triangles (in ascending order) that the line/sphere (in object space) may touch, until it returns false.
+// The triangle planes must be calculated already (See `CCollision::CalculateTrianglePlanes`)
+template<typename Shape, typename Fn>
+static void ForEachTriangleTouching(const CCollisionData& cd, const Shape& shape, Fn&& fn) {
+    if (const auto bvh = notsa::ColTriangleBVH::Get(cd)) {
+        std::array<std::byte, 512> mem; // Enough for most queries, the rest goes on the heap
+        std::pmr::monotonic_buffer_resource res{ mem.data(), mem.size() };
+        std::pmr::vector<uint16> tris{ &res };
+        if constexpr (std::is_base_of_v<CSphere, Shape>) {
+            bvh->FindTrianglesTouchingSphere(shape, tris);
+        } else {
+            bvh->FindTrianglesTouchingLine(shape, tris);
+        }
+        for (const auto triIdx : tris) {
+            if (!std::invoke(fn, (uint32)triIdx)) {
+                break;
+            }
+        }
+    } else {
+        for (auto triIdx = 0u; triIdx < cd.m_nNumTriangles; triIdx++) {
+            if (!std::invoke(fn, triIdx)) {
+                break;
+            }
+        }
+    }
+}
+
 // 0x411E70
 bool CCollision::TestSphereSphere(CColSphere const& sphere1, CColSphere const& sphere2) { // Yes, it's __stdcall
     ZoneScoped;
@@ -1696,14 +1725,14 @@ bool CCollision::TestLineOfSight(
     CalculateTrianglePlanes(cd);
     const auto verts = cd->GetTriVerts();
     const auto pls   = cd->GetTriPlanes();
-    for (const auto&& [idx, tri] : rngv::enumerate(cd->GetTris())) { // TODO: rng::zip
-        if (ShouldTest(tri.GetSurfaceType()) && TestLineTriangle(lnos, verts, tri, pls[idx])) {
-            return true;
-        }
-    }
+    bool hitTri{};
+    ForEachTriangleTouching(*cd, lnos, [&](uint32 idx) { // NOTSA: Originally went through all triangles
+        const auto& tri = cd->m_pTriangles[idx];
+        hitTri = ShouldTest(tri.GetSurfaceType()) && TestLineTriangle(lnos, verts, tri, pls[idx]);
+        return !hitTri;
+    });
 
-    // No intersection whatsovever
-    return false;
+    return hitTri;
 }
 
 // 0x417950
@@ -1749,12 +1778,20 @@ bool CCollision::ProcessLineOfSight(const CColLine& lnws, const CMatrix& transfo
 
     CalculateTrianglePlanes(colData);
 
-    for (auto i = 0; i < colData->m_nNumTriangles; i++) {
+    // NOTSA: Originally went through all triangles, and counted all that passed the checks - So with the BVH all of them are counted at once
+    const auto bvh = notsa::ColTriangleBVH::Get(*colData);
+    if (bvh) {
+        ms_iProcessLineNumCrossings += bvh->GetNumTrianglesPassing(doSeeThroughCheck, doShootThroughCheck);
+    }
+    ForEachTriangleTouching(*colData, line_OS, [&](uint32 i) {
         if (const auto& tri = colData->m_pTriangles[i]; CheckSeeAndShootThrough(tri.m_nMaterial)) {
             results |= ProcessLineTriangle(line_OS, colData->m_pVertices, tri, colData->m_pTrianglePlanes[i], colPoint, localMinTouchDist, nullptr);
-            ms_iProcessLineNumCrossings++;
+            if (!bvh) {
+                ms_iProcessLineNumCrossings++;
+            }
         }
-    }
+        return true;
+    });
 
     if (localMinTouchDist < maxTouchDistance) {
         colPoint.m_vecPoint = transform.TransformPoint(colPoint.m_vecPoint);
@@ -1820,11 +1857,12 @@ bool CCollision::ProcessVerticalLine(
     CStoredCollPoly storedColPoly{};
     const auto verts = cd->GetTriVerts();
     const auto pls   = cd->GetTriPlanes();
-    for (const auto&& [idx, tri] : rngv::enumerate(cd->GetTris())) { // TODO: rng::zip
-        if (ShouldTest(tri.GetSurfaceType())) {
+    ForEachTriangleTouching(*cd, lnos, [&](uint32 idx) { // NOTSA: Originally went through all triangles
+        if (const auto& tri = cd->m_pTriangles[idx]; ShouldTest(tri.GetSurfaceType())) {
             ProcessLineTriangle(lnos, verts, tri, pls[idx], cp, localMaxTouchDist, &storedColPoly);
         }
-    }
+        return true;
+    });
 
     if (localMaxTouchDist >= maxTouchDistance) {
         return false; // No collisions closer to line origin than originally
@@ -2048,9 +2086,10 @@ int32 CCollision::ProcessColModels(const CMatrix& transformA, CColModel& cmA,
             }
         } else { // Game checked here if B.m_nNumTriangles > 0, but that is a redundant check.
             // 0x418C40
-            for (auto triIdx = 0u; triIdx < cdB.m_nNumTriangles && numCollTrisB < MAX_TRIS; triIdx++) {
+            ForEachTriangleTouching(cdB, colABoundSphereSpaceB, [&](uint32 triIdx) { // NOTSA: Originally went through all triangles
                 ProcessOneTri(triIdx);
-            }
+                return numCollTrisB < MAX_TRIS;
+            });
         }
     }
 
@@ -2225,11 +2264,12 @@ int32 CCollision::ProcessColModels(const CMatrix& transformA, CColModel& cmA,
 
             // NOTE/TODO: Weird how they didn'maxTouchDist use the facegroup stuff here as well.
             //            Should probably implement it here some day too, as it speeds up the process quite a bit.
-            for (auto triIdx = 0; triIdx < cdA.m_nNumTriangles; triIdx++) {
+            ForEachTriangleTouching(cdA, colBSphereInASpace, [&](uint32 triIdx) { // NOTSA: Originally went through all triangles
                 if (TestSphereTriangle(colBSphereInASpace, cdA.m_pVertices, cdA.m_pTriangles[triIdx], cdA.m_pTrianglePlanes[triIdx])) {
                     collTriA[numCollTriA++] = triIdx;
                 }
-            }
+                return true;
+            });
         }
 
         // 0x419AB6
@@ -2,6 +2,7 @@
 
 #include "CollisionData.h"
 #include "ColHelpers.h"
+#include "ColTriangleBVH.h"
 
 void CCollisionData::InjectHooks() {
     RH_ScopedClass(CCollisionData);
@@ -187,10 +188,12 @@ void CCollisionData::CalculateTrianglePlanes() {
     for (auto i = 0; i < m_nNumTriangles; ++i) {
         m_pTrianglePlanes[i].Set(m_pVertices, m_pTriangles[i]);
     }
+    notsa::ColTriangleBVH::Build(*this); // NOTSA: It lives as long as the planes
 }
 
 // 0x40F6A0
 void CCollisionData::RemoveTrianglePlanes() {
+    notsa::ColTriangleBVH::Remove(*this); // NOTSA: It lives as long as the planes
     CMemoryMgr::Free(m_pTrianglePlanes);
     m_pTrianglePlanes = nullptr;
 }
@@ -6,6 +6,11 @@
 */
 #pragma once
 
+#include <array>
+#include <bit>
+#include <span>
+#include <vector>
+
 #include "Link.h"
 
 template <typename T> class CLinkList {
@@ -74,6 +79,90 @@ public:
         return link;
     }
 
+    /*!
+     * @brief NOTSA - Insert without keeping the list sorted (O(1) instead of `InsertSorted`'s O(n)).
+     * @brief `SortByDistance` must be called before the list is walked in order. The resulting order is the same as if `InsertSorted` was used:
+     * @brief `InsertSorted` puts a new link before all links of equal distance, so of those the newest is the closest to the head.
+     * @brief This inserts at the head (newest first), and `SortByDistance` is stable, so equal links end up in the same order.
+     */
+    CLink<T>* InsertDeferredSorted(T const& data) {
+        return Insert(data);
+    }
+
+    /*!
+     * @brief NOTSA - Sort the used list by `m_distance` (ascending from the head) using a stable LSD radix sort on the distances' bits.
+     * @brief Does nothing if the list is already sorted.
+     * @tparam MaxLinksOnStack Lists with up to this many used links are sorted using buffers on the stack, longer ones allocate them
+     */
+    template<size_t MaxLinksOnStack = 256>
+    void SortByDistance() {
+        size_t numLinks = 0;
+        for (auto* l = usedListHead.next; l != &usedListTail; l = l->next) {
+            numLinks++;
+        }
+        if (numLinks <= MaxLinksOnStack) {
+            std::array<CLink<T>*, MaxLinksOnStack> links, scratch;
+            std::array<uint32, MaxLinksOnStack>    keys, scratchKeys;
+            SortByDistanceUsing({ links.data(), numLinks }, { scratch.data(), numLinks }, { keys.data(), numLinks }, { scratchKeys.data(), numLinks });
+        } else {
+            std::vector<CLink<T>*> links(numLinks), scratch(numLinks);
+            std::vector<uint32>    keys(numLinks), scratchKeys(numLinks);
+            SortByDistanceUsing(links, scratch, keys, scratchKeys);
+        }
+    }
+
+private:
+    //! Sort using the given buffers - Each must be as big as the number of used links
+    void SortByDistanceUsing(std::span<CLink<T>*> links, std::span<CLink<T>*> scratch, std::span<uint32> keys, std::span<uint32> scratchKeys) {
+        // Map the floats into uint32's that compare the same way
+        const auto GetKey = [](float distance) {
+            const auto bits = std::bit_cast<uint32>(distance == 0.0f ? 0.0f : distance); // -0 and +0 are equal for `InsertSorted`
+            return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+        };
+
+        bool   isSorted = true;
+        size_t n        = 0;
+        for (auto* l = usedListHead.next; l != &usedListTail; l = l->next, n++) {
+            keys[n]  = GetKey(l->data.m_distance);
+            links[n] = l;
+            isSorted &= n == 0 || keys[n - 1] <= keys[n];
+        }
+        if (isSorted) {
+            return;
+        }
+
+        for (auto shift = 0u; shift < 32u; shift += 8u) {
+            std::array<uint32, 256 + 1> offsets{};
+            for (const auto key : keys) {
+                offsets[((key >> shift) & 0xFF) + 1]++;
+            }
+            if (std::ranges::find(offsets, (uint32)keys.size()) != offsets.end()) {
+                continue; // All keys have the same digit, nothing to do in this pass
+            }
+            for (auto i = 1u; i < offsets.size(); i++) {
+                offsets[i] += offsets[i - 1];
+            }
+            for (auto i = 0u; i < keys.size(); i++) {
+                const auto dst = offsets[(keys[i] >> shift) & 0xFF]++;
+                scratch[dst]     = links[i];
+                scratchKeys[dst] = keys[i];
+            }
+            std::swap(links, scratch);
+            std::swap(keys, scratchKeys);
+        }
+
+        // Relink in the new order
+        auto* prev = &usedListHead;
+        for (auto* l : links) {
+            prev->next = l;
+            l->prev    = prev;
+            prev       = l;
+        }
+        prev->next        = &usedListTail;
+        usedListTail.prev = prev;
+    }
+
+public:
     void Clear() {
         for (CLink<T>* link = usedListHead.next; link != &usedListTail; link = usedListHead.next) {
             Remove(link);
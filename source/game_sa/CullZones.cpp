@@ -2,6 +2,145 @@
 
 #include "CullZones.h"
 
+// NOTSA: Uniform 2D grid over the XY bounds of a cull zone array, so the `Find*` functions only have to check the zones overlapping the point's cell.
+// Each cell has the indices of the zones overlapping it in ascending order (So the zones are checked in the same order as the linear scan)
+// The whole array is indexed (not just the first `Num*` zones) as the linear scans go through all of it too.
+// The grid covers the bounds of the (bounded) zones, and is rebuilt (lazily) whenever zones are added (See `Invalidate`)
+class CullZoneGrid {
+public:
+    static constexpr int32 GRID_NUM_CELLS = 24; // Per axis
+
+    //! Rebuild the grid if it was invalidated (or the number of zones changed) since it was built
+    template<typename T, size_t N>
+    void Update(const T (&zones)[N], int32 numZones) {
+        if (m_IsDirty || m_NumZones != numZones) { // The count is checked too, as zones may be added by unhooked code
+            Build(zones);
+            m_NumZones = numZones;
+            m_IsDirty  = false;
+        }
+    }
+
+    //! Invalidate the grid, it'll be rebuilt on the next `Update` - Must be called whenever the zones are written
+    void Invalidate() { m_IsDirty = true; }
+
+    //! Indices of the zones that may contain the point (in ascending order), or `nullopt` if it's outside of the grid (and all zones have to be checked)
+    std::optional<std::span<const uint16>> GetZonesAt(const CVector& point) const {
+        if (m_CellSizeX <= 0.0 || m_CellSizeY <= 0.0) { // No bounded zones
+            return std::nullopt;
+        }
+        const auto cx = (int32)std::floor(((double)point.x - m_MinX) / m_CellSizeX),
+                   cy = (int32)std::floor(((double)point.y - m_MinY) / m_CellSizeY);
+        if (cx < 0 || cx >= GRID_NUM_CELLS || cy < 0 || cy >= GRID_NUM_CELLS) {
+            return std::nullopt;
+        }
+        return m_Cells[cy * GRID_NUM_CELLS + cx];
+    }
+
+private:
+    template<typename T, size_t N>
+    void Build(const T (&zones)[N]) {
+        ZoneScoped;
+
+        for (auto& cell : m_Cells) {
+            cell.clear();
+        }
+
+        // `IsPointWithin` is always false for these (Eg.: Unused zones)
+        const auto CanMatch = [](const CZoneDef& zd) {
+            return zd.bottomZ < zd.topZ && GetMaxDotA(zd) >= 0.0 && GetMaxDotB(zd) >= 0.0;
+        };
+
+        // Make the grid cover the bounded zones (2 units of margin for the float rounding of `IsPointWithin`)
+        double minX{ DBL_MAX }, minY{ DBL_MAX }, maxX{ -DBL_MAX }, maxY{ -DBL_MAX };
+        for (const auto& zone : zones) {
+            if (!CanMatch(zone.zoneDef)) {
+                continue;
+            }
+            if (const auto bounds = GetBounds(zone.zoneDef)) {
+                const auto [min, max] = *bounds;
+                minX = std::min(minX, min.first - 2.0);
+                minY = std::min(minY, min.second - 2.0);
+                maxX = std::max(maxX, max.first + 2.0);
+                maxY = std::max(maxY, max.second + 2.0);
+            }
+        }
+        if (minX > maxX) { // No bounded zones, everything goes through the linear scan
+            m_CellSizeX = m_CellSizeY = 0.0;
+            return;
+        }
+        m_MinX      = minX;
+        m_MinY      = minY;
+        m_CellSizeX = std::max(maxX - minX, 1.0) / GRID_NUM_CELLS;
+        m_CellSizeY = std::max(maxY - minY, 1.0) / GRID_NUM_CELLS;
+
+        for (auto&& [i, zone] : rngv::enumerate(zones)) {
+            const auto& zd = zone.zoneDef;
+            if (!CanMatch(zd)) {
+                continue;
+            }
+            int32 x1{}, y1{}, x2{ GRID_NUM_CELLS - 1 }, y2{ GRID_NUM_CELLS - 1 }; // Whole grid if unbounded
+            if (const auto bounds = GetBounds(zd)) {
+                const auto [min, max] = *bounds;
+                const auto GetCellRange = [](double min, double max, double gridMin, double cellSize) {
+                    return std::make_pair(
+                        std::clamp((int32)std::floor((min - 2.0 - gridMin) / cellSize), 0, GRID_NUM_CELLS - 1),
+                        std::clamp((int32)std::floor((max + 2.0 - gridMin) / cellSize), 0, GRID_NUM_CELLS - 1)
+                    );
+                };
+                std::tie(x1, x2) = GetCellRange(min.first, max.first, m_MinX, m_CellSizeX);
+                std::tie(y1, y2) = GetCellRange(min.second, max.second, m_MinY, m_CellSizeY);
+            }
+            for (auto y = y1; y <= y2; y++) {
+                for (auto x = x1; x <= x2; x++) {
+                    m_Cells[y * GRID_NUM_CELLS + x].push_back((uint16)i);
+                }
+            }
+        }
+    }
+
+    // Upper limits of the dot products checked by `CZoneDef::IsPointWithin` - Calculated exactly the same way
+    static double GetMaxDotA(const CZoneDef& zd) { return (float)(sq(zd.m_lenY) + sq(zd.m_x2)); }
+    static double GetMaxDotB(const CZoneDef& zd) { return (float)(sq(zd.m_y3) + sq(zd.m_lenX)); }
+
+    // XY bounds of the area where `CZoneDef::IsPointWithin` may be true, `nullopt` if it's unbounded
+    // The point (relative to the zone's corner) must satisfy `0 <= d.A <= GetMaxDotA()` and `0 <= d.B <= GetMaxDotB()`, that's a parallelogram, unless `A` and `B` are parallel
+    static std::optional<std::pair<std::pair<double, double>, std::pair<double, double>>> GetBounds(const CZoneDef& zd) {
+        const double ax = zd.m_x2, ay = zd.m_lenY, bx = zd.m_lenX, by = zd.m_y3;
+        const auto   det = ax * by - ay * bx;
+        if (det == 0.0) {
+            return std::nullopt;
+        }
+        auto min = std::make_pair(DBL_MAX, DBL_MAX), max = std::make_pair(-DBL_MAX, -DBL_MAX);
+        for (const auto a : { 0.0, GetMaxDotA(zd) }) {
+            for (const auto b : { 0.0, GetMaxDotB(zd) }) {
+                const auto x = (double)zd.m_x1 + (a * by - b * ay) / det,
+                           y = (double)zd.m_y1 + (b * ax - a * bx) / det;
+                min = { std::min(min.first, x), std::min(min.second, y) };
+                max = { std::max(max.first, x), std::max(max.second, y) };
+            }
+        }
+        return std::make_pair(min, max);
+    }
+
+private:
+    std::array<std::vector<uint16>, GRID_NUM_CELLS * GRID_NUM_CELLS> m_Cells{};
+    double                                                            m_MinX{}, m_MinY{}, m_CellSizeX{}, m_CellSizeY{};
+    int32                                                             m_NumZones{ -1 };
+    bool                                                              m_IsDirty{ true };
+};
+
+static CullZoneGrid s_AttributeZoneGrid{}, s_TunnelAttributeZoneGrid{}, s_MirrorAttributeZoneGrid{};
+
+// NOTSA - Call `fn` with each zone of the array that may contain the point (in ascending order), until it returns true
+template<typename T, size_t N>
+static bool ForEachCullZoneAt(CullZoneGrid& grid, T (&zones)[N], int32 numZones, const CVector& point, auto&& fn) {
+    grid.Update(zones, numZones);
+    if (const auto indices = grid.GetZonesAt(point)) {
+        return rng::any_of(*indices, [&](uint16 i) { return fn(zones[i]); });
+    }
+    return rng::any_of(zones, fn); // Outside of the grid, do it the original way
+}
+
 void CCullZones::InjectHooks() {
     RH_ScopedClass(CCullZones);
     RH_ScopedCategoryGlobal();
@@ -31,6 +170,8 @@ void CCullZones::Init() {
     NumAttributeZones = 0;
     CurrentFlags_Player = 0;
     CurrentFlags_Camera = 0;
+
+    s_AttributeZoneGrid.Invalidate(); // NOTSA
 }
 
 // flags: see eZoneAttributes
@@ -48,6 +189,8 @@ void CCullZones::AddCullZone(const CVector& center, float unk1, float fWidthY, f
         zone.flags = static_cast<eZoneAttributes>(flags);
 
         NumAttributeZones += 1;
+
+        s_AttributeZoneGrid.Invalidate(); // NOTSA
     }
 }
 
@@ -60,6 +203,8 @@ void CCullZones::AddTunnelAttributeZone(const CVector& center, float unk1, float
     zone.flags = static_cast<eZoneAttributes>(flags);
 
     NumTunnelAttributeZones += 1;
+
+    s_TunnelAttributeZoneGrid.Invalidate(); // NOTSA
 }
 
 // 0x72DC10
@@ -74,6 +219,8 @@ void CCullZones::AddMirrorAttributeZone(const CVector& center, float unk1, float
     zone.vz = (int8)(vZ * 100.0f);
 
     NumMirrorAttributeZones += 1;
+
+    s_MirrorAttributeZoneGrid.Invalidate(); // NOTSA
 }
 
 // 0x72DD70
@@ -117,11 +264,12 @@ eZoneAttributes CCullZones::FindTunnelAttributesForCoors(CVector point) {
         return eZoneAttributes::NONE;
 
     int32 out = eZoneAttributes::NONE;
-    for (CCullZone& zone : aTunnelAttributeZones) {
+    ForEachCullZoneAt(s_TunnelAttributeZoneGrid, aTunnelAttributeZones, NumTunnelAttributeZones, point, [&](CCullZone& zone) {
         if (zone.IsPointWithin(point)) {
             out |= zone.flags;
         }
-    }
+        return false;
+    });
 
     return static_cast<eZoneAttributes>(out);
 }
@@ -131,13 +279,16 @@ CCullZoneReflection* CCullZones::FindMirrorAttributesForCoors(CVector cameraPosi
     if (NumMirrorAttributeZones <= 0)
         return nullptr;
 
-    for (CCullZoneReflection& zone : aMirrorAttributeZones) {
+    CCullZoneReflection* found{};
+    ForEachCullZoneAt(s_MirrorAttributeZoneGrid, aMirrorAttributeZones, NumMirrorAttributeZones, cameraPosition, [&](CCullZoneReflection& zone) {
         if (zone.IsPointWithin(cameraPosition)) {
-            return &zone;
+            found = &zone;
+            return true;
         }
-    }
+        return false;
+    });
 
-    return nullptr;
+    return found;
 }
 
 // 0x72DAD0
@@ -145,15 +296,19 @@ CCullZone* CCullZones::FindZoneWithStairsAttributeForPlayer() {
     if (NumAttributeZones <= 0)
         return nullptr;
 
-    for (CCullZone& zone : aAttributeZones) {
+    const auto playerPos = FindPlayerCoors();
+    CCullZone* found{};
+    ForEachCullZoneAt(s_AttributeZoneGrid, aAttributeZones, NumAttributeZones, playerPos, [&](CCullZone& zone) {
         if ((zone.flags & eZoneAttributes::CAM_STAIRS_FOR_PLAYER) != 0 &&
-            zone.IsPointWithin(FindPlayerCoors())
+            zone.IsPointWithin(playerPos)
         ) {
-            return &zone;
+            found = &zone;
+            return true;
         }
-    }
+        return false;
+    });
 
-    return nullptr;
+    return found;
 }
 
 // 0x72D970
@@ -162,11 +317,12 @@ eZoneAttributes CCullZones::FindAttributesForCoors(CVector pos) {
         return eZoneAttributes::NONE;
 
     int32 out = eZoneAttributes::NONE;
-    for (CCullZone& zone : aAttributeZones) {
+    ForEachCullZoneAt(s_AttributeZoneGrid, aAttributeZones, NumAttributeZones, pos, [&](CCullZone& zone) {
         if (zone.IsPointWithin(pos)) {
             out |= zone.flags;
         }
-    }
+        return false;
+    });
 
     return static_cast<eZoneAttributes>(out);
 }
@@ -747,7 +747,7 @@ void CCutsceneMgr::LoadCutsceneData_preload() {
             continue;
         }
         CStreaming::RemoveModel(i);
-        mi->m_nKey = CKeyGen::GetUppercaseKey("&*%"); // Set some invalid key I guess? I don't think anything like this is used anywhere :D
+        mi->SetModelName("&*%"); // Set some invalid key I guess? I don't think anything like this is used anywhere :D
     }
 
     // Save states
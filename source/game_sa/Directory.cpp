@@ -1,7 +1,54 @@
 #include "StdInc.h"
 
+#include <unordered_map>
+
 #include "Directory.h"
 
+namespace {
+/*!
+* @brief NOTSA - Case-insensitive name index of a directory (`CKeyGen::GetUppercaseKey` of the name -> entry index)
+* @brief It's stored out-of-line, as `CDirectory`'s layout is fixed (Some instances live in the game's memory)
+*/
+struct DirectoryIndex {
+    const CDirectory::DirectoryInfo* Entries{};         //!< The entries the index was built for
+    uint32                           NumIndexed{};      //!< No. of entries indexed so far
+    std::unordered_map<uint32, uint32> FirstEntryOfKey; //!< First entry of each key (Same one as a linear search would find)
+};
+};
+
+static std::unordered_map<const CDirectory*, DirectoryIndex> s_DirectoryIndices;
+
+// NOTSA - Get the index of the directory, making sure it's up-to-date with it's entries
+// [The entries might've been changed by `Init`, `Clear` or unhooked code]
+static DirectoryIndex& GetUpToDateIndex(const CDirectory& dir) {
+    auto& idx = s_DirectoryIndices[&dir];
+    if (idx.Entries != dir.m_pEntries || idx.NumIndexed > dir.m_nNumEntries) {
+        idx.Entries    = dir.m_pEntries;
+        idx.NumIndexed = 0;
+        idx.FirstEntryOfKey.clear();
+        idx.FirstEntryOfKey.reserve(dir.m_nCapacity);
+    }
+    for (; idx.NumIndexed < dir.m_nNumEntries; idx.NumIndexed++) {
+        idx.FirstEntryOfKey.try_emplace(CKeyGen::GetUppercaseKey(dir.m_pEntries[idx.NumIndexed].Name), idx.NumIndexed);
+    }
+    return idx;
+}
+
+// NOTSA - Find the entry with the given key, O(1)
+static CDirectory::DirectoryInfo* FindItemByKey(const CDirectory& dir, uint32 key) {
+    const auto& idx = GetUpToDateIndex(dir);
+    const auto  it  = idx.FirstEntryOfKey.find(key);
+    if (it == idx.FirstEntryOfKey.end()) {
+        return nullptr;
+    }
+    auto* const entry = &dir.m_pEntries[it->second];
+    if (CKeyGen::GetUppercaseKey(entry->Name) != key) { // Entry was overwritten behind our back, rebuild the index
+        s_DirectoryIndices.erase(&dir);
+        return FindItemByKey(dir, key);
+    }
+    return entry;
+}
+
 void CDirectory::InjectHooks() {
     RH_ScopedClass(CDirectory);
     RH_ScopedCategoryGlobal();
@@ -36,6 +83,7 @@ CDirectory::~CDirectory() {
     if (m_pEntries && m_bOwnsEntries) {
         delete[] m_pEntries;
     }
+    s_DirectoryIndices.erase(this); // NOTSA
 }
 
 // 0x5322F0
@@ -44,6 +92,13 @@ void CDirectory::Init(int32 capacity, DirectoryInfo* entries) {
     m_pEntries = entries;
     m_nNumEntries = 0;
     m_bOwnsEntries = false;
+    s_DirectoryIndices.erase(this); // NOTSA
+}
+
+// NOTSA
+void CDirectory::Clear() {
+    m_nNumEntries = 0;
+    s_DirectoryIndices.erase(this);
 }
 
 // 0x532310
@@ -51,13 +106,12 @@ void CDirectory::AddItem(const DirectoryInfo& dirInfo) {
     if (m_nNumEntries < m_nCapacity) {
 #ifdef FIX_BUGS
         // don't add if already exists
-        uint32 size;
-        CdStreamPos pos;
-        if (FindItem(dirInfo.Name, pos, size)) {
+        if (FindItem(dirInfo.Name)) {
             return;
         }
 #endif
         m_pEntries[m_nNumEntries++] = dirInfo;
+        GetUpToDateIndex(*this); // NOTSA: Index the new entry
     } else {
         NOTSA_LOG_DEBUG("Too many objects without modelinfo structures");
     }
@@ -104,6 +158,12 @@ CDirectory::DirectoryInfo* CDirectory::FindItem(const char* itemName) const {
     if (m_nNumEntries <= 0) {
         return nullptr;
     }
+    // NOTSA: Look it up in the index, instead of a linear search
+    auto* const entry = FindItemByKey(*this, CKeyGen::GetUppercaseKey(itemName));
+    if (!entry || _stricmp(entry->Name, itemName) == 0) {
+        return entry;
+    }
+    // Different name with the same key [Hash collision], fall back to a linear search
     for (DirectoryInfo* it = m_pEntries; it != m_pEntries + m_nNumEntries; it++) {
         if (_stricmp(it->Name, itemName) == 0) {
             return it;
@@ -127,12 +187,10 @@ bool CDirectory::FindItem(uint32 hashKey, CdStreamPos& pos, uint32& outSize) con
     if (m_nNumEntries <= 0) {
         return false;
     }
-    for (DirectoryInfo* it = m_pEntries; it != m_pEntries + m_nNumEntries; it++) {
-        if (CKeyGen::GetUppercaseKey(it->Name) == hashKey) {
-            pos     = it->Pos;
-            outSize = it->Size;
-            return true;
-        }
+    if (const auto* const it = FindItemByKey(*this, hashKey)) { // NOTSA: Originally a linear search
+        pos     = it->Pos;
+        outSize = it->Size;
+        return true;
     }
     return false;
 }
@@ -1,6 +1,7 @@
 #include "StdInc.h"
 
 #include "Building.h"
+#include "SectorBuildingArray.h"
 
 int32& gBuildings = *(int32*)0xB71804;
 
@@ -31,6 +32,8 @@ void CBuilding::operator delete(void* data)
 
 void CBuilding::ReplaceWithNewModel(int32 newModelIndex)
 {
+    notsa::SectorBuildingArray::InvalidateSectorsOf(*this); // NOTSA: Bounding sphere changes with the model
+
     DeleteRwObject();
     if (!CModelInfo::GetModelInfo(m_nModelIndex)->m_nRefCount)
         CStreaming::RemoveModel(m_nModelIndex);
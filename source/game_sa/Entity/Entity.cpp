@@ -22,6 +22,7 @@
 #include "TheScripts.h"
 #include "Shadows.h"
 #include "CustomBuildingRenderer.h"
+#include "SectorBuildingArray.h"
 
 void CEntity::InjectHooks()
 {
@@ -120,6 +121,10 @@ CEntity::CEntity() : CPlaceable() {
 
 CEntity::~CEntity()
 {
+    if (IsBuilding()) { // NOTSA: A new building may be allocated at the same address
+        notsa::SectorBuildingArray::InvalidateSectorsOf(*this);
+    }
+
     if (m_pLod)
         m_pLod->m_nNumLodChildren--;
 
@@ -174,7 +179,11 @@ void CEntity::Add(const CRect& rect)
                 case ENTITY_TYPE_VEHICLE:  ProcessAddItem(rs->Vehicles);   break;
                 case ENTITY_TYPE_PED:      ProcessAddItem(rs->Peds);       break;
                 case ENTITY_TYPE_OBJECT:   ProcessAddItem(rs->Objects);    break;
-                case ENTITY_TYPE_BUILDING: ProcessAddItem(s->m_buildings); break;
+                case ENTITY_TYPE_BUILDING: {
+                    ProcessAddItem(s->m_buildings);
+                    notsa::SectorBuildingArray::Invalidate(*s); // NOTSA
+                    break;
+                }
                 }
             }
         }
@@ -226,7 +235,11 @@ void CEntity::Remove()
                 case ENTITY_TYPE_VEHICLE:  ProcessDeleteItem(rs->Vehicles);   break;
                 case ENTITY_TYPE_PED:      ProcessDeleteItem(rs->Peds);       break;
                 case ENTITY_TYPE_OBJECT:   ProcessDeleteItem(rs->Objects);    break;
-                case ENTITY_TYPE_BUILDING: ProcessDeleteItem(s->m_buildings); break;
+                case ENTITY_TYPE_BUILDING: {
+                    ProcessDeleteItem(s->m_buildings);
+                    notsa::SectorBuildingArray::Invalidate(*s); // NOTSA
+                    break;
+                }
                 }
             }
         }
@@ -1594,13 +1607,22 @@ void CEntity::CalculateBBProjection(CVector* corner1, CVector* corner2, CVector*
 
 // 0x535F00
 void CEntity::UpdateAnim()
+{
+    RpAnimBlendClumpUpdateArgs args;
+    if (GetAnimUpdateArgs(args)) {
+        RpAnimBlendClumpUpdateAnimations(args.Clump, args.TimeStep, args.IsOnScreen);
+    }
+}
+
+// NOTSA - Code from `UpdateAnim`
+bool CEntity::GetAnimUpdateArgs(RpAnimBlendClumpUpdateArgs& outArgs)
 {
     m_bDontUpdateHierarchy = false;
     if (!m_pRwObject || RwObjectGetType(m_pRwObject) != rpCLUMP)
-        return;
+        return false;
 
     if (!RpAnimBlendClumpGetFirstAssociation(m_pRwClump))
-        return;
+        return false;
 
 
     bool bOnScreen;
@@ -1617,7 +1639,8 @@ void CEntity::UpdateAnim()
         fStep = CTimer::GetTimeStepInSeconds();
     }
 
-    RpAnimBlendClumpUpdateAnimations(m_pRwClump, fStep, bOnScreen);
+    outArgs = { m_pRwClump, fStep, bOnScreen };
+    return true;
 }
 
 // 0x536BC0
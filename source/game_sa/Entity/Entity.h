@@ -33,6 +33,7 @@ class CDummy;
 class CBuilding;
 class CDummy;
 class CPhysical;
+struct RpAnimBlendClumpUpdateArgs;
 class CBaseModelInfo;
 
 class NOTSA_EXPORT_VTABLE CEntity : public CPlaceable {
@@ -171,6 +172,13 @@ public:
     CColModel* GetColModel() const;
     void CalculateBBProjection(CVector* corner1, CVector* corner2, CVector* corner3, CVector* corner4);
     void UpdateAnim();
+
+    /*!
+    * @notsa
+    * @brief Same as `UpdateAnim`, but instead of updating the animations get the arguments they'd be updated with
+    * @return Whenever there are any animations to update
+    */
+    bool GetAnimUpdateArgs(RpAnimBlendClumpUpdateArgs& outArgs);
     bool IsVisible();
     float GetDistanceFromCentreOfMassToBaseOfModel() const;
     void CleanUpOldReference(CEntity** entity); // See helper SafeCleanUpOldReference
@@ -127,7 +127,7 @@ int32 CFileLoader::LoadAnimatedClumpObject(const char* line) {
 
     auto mi = CModelInfo::AddClumpModel(objID);
 
-    mi->m_nKey = CKeyGen::GetUppercaseKey(modelName);
+    mi->SetModelName(modelName);
     mi->SetTexDictionary(txdName);
     mi->m_fDrawDistance = drawDist; // if you forgot to add this line here, you will meet with UB on closing game, have a nice day
     mi->SetAnimFile(animName);
@@ -1471,7 +1471,7 @@ int32 CFileLoader::LoadPedObject(const char* line) {
 
     const auto mi = CModelInfo::AddPedModel(modelId);
 
-    mi->m_nKey = CKeyGen::GetUppercaseKey(modelName);
+    mi->SetModelName(modelName);
     mi->SetTexDictionary(texName);
     mi->SetAnimFile(animFile);
     mi->SetColModel(&CTempColModels::ms_colModelPed1, false);
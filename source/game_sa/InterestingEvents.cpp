@@ -308,15 +308,29 @@ void CInterestingEvents::InvalidateEvent(const TInterestingEvent* event) {
 // 0x6029C0
 void CInterestingEvents::InvalidateNonVisibleEvents() {
     const auto& camPos = CCamera::GetActiveCamera().m_vecSource;
+
+    // NOTSA: Check the events' visibility all at once
+    std::array<CColLine, MAX_INTERESTING_EVENTS> lines{};
+    std::array<int32, MAX_INTERESTING_EVENTS>    lineEvents{};
+    size_t                                       numLines{};
     for (auto i = 0; i < MAX_INTERESTING_EVENTS; i++) {
         TInterestingEvent& event = m_Events[i];
         if (!event.entity)
             continue;
 
-        CVector pos = event.entity->GetPosition();
-        if (CWorld::GetIsLineOfSightClear(camPos, pos, true, false, false, false, false, true, false))
+        lines[numLines]        = CColLine{ camPos, event.entity->GetPosition() };
+        lineEvents[numLines++] = i;
+    }
+
+    std::array<bool, MAX_INTERESTING_EVENTS> isClear{};
+    CWorld::GetAreLinesOfSightClear(std::span{ lines }.first(numLines), isClear, true, false, false, false, false, true, false);
+
+    for (size_t l = 0; l < numLines; l++) {
+        if (isClear[l])
             continue;
 
+        const auto i = lineEvents[l];
+        TInterestingEvent& event = m_Events[i];
         event.time = 0;
         CEntity::SafeCleanUpRef(event.entity);
         if (m_nInterestingEvent == i) {
@@ -218,3 +218,9 @@ void SetBaseModelInfoFlags(CBaseModelInfo* modelInfo, uint32 flags) {
 void CBaseModelInfo::SetBaseModelInfoFlags(uint32 flags) {
     ::SetBaseModelInfoFlags(this, flags);
 }
+
+// NOTSA
+void CBaseModelInfo::SetModelKey(uint32 key) {
+    const auto oldKey = std::exchange(m_nKey, key);
+    CModelInfo::OnModelKeyChanged(this, oldKey);
+}
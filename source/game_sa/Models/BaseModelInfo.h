@@ -171,7 +171,8 @@ public:
             m_nAlpha += 16;
     };
     [[nodiscard]] auto GetModelName() const noexcept { return m_nKey; }
-    void SetModelName(const char* modelName) { m_nKey = CKeyGen::GetUppercaseKey(modelName); }
+    void SetModelName(const char* modelName) { SetModelKey(CKeyGen::GetUppercaseKey(modelName)); }
+    void SetModelKey(uint32 key); // NOTSA - Keeps `CModelInfo`'s key index up-to-date, prefer it over setting `m_nKey` directly
 
     [[nodiscard]] bool IsSwayInWind1()         const { return nSpecialType == eModelInfoSpecialType::TREE; }               // 0x0800
     [[nodiscard]] bool IsSwayInWind2()         const { return nSpecialType == eModelInfoSpecialType::PALM; }               // 0x1000
@@ -7,6 +7,8 @@
 
 #include "StdInc.h"
 
+#include <unordered_map>
+
 #include "ModelInfo.h"
 #include "TempColModels.h"
 
@@ -24,6 +26,87 @@ CStore<CVehicleModelInfo, CModelInfo::NUM_VEHICLE_MODEL_INFOS>& CModelInfo::ms_v
 CStore<CPedModelInfo, CModelInfo::NUM_PED_MODEL_INFOS>& CModelInfo::ms_pedModelInfoStore = *(CStore<CPedModelInfo, NUM_PED_MODEL_INFOS>*)0xB478F8;
 CStore<C2dEffect, CModelInfo::NUM_2DFX_INFOS>& CModelInfo::ms_2dFXInfoStore = *(CStore<C2dEffect, NUM_2DFX_INFOS>*)0xB4C2D8;
 
+// NOTSA - Key index, used instead of searching `ms_modelInfoPtrs` linearly
+struct ModelKeyIndexEntry {
+    int32  LowestId{ MODEL_INVALID }; //!< Lowest id of a model with this key (That's the one a linear search would find), `MODEL_INVALID` if it has to be looked up again
+    uint32 NumModels{};               //!< No. of models with this key
+};
+static std::unordered_map<uint32, ModelKeyIndexEntry>  s_ModelKeyIndex; //!< Key -> Models with that key
+static std::unordered_map<const CBaseModelInfo*, int32> s_ModelIdOfInfo; //!< Model info -> It's id
+
+static void AddToModelKeyIndex(uint32 key, int32 id) {
+    auto& e = s_ModelKeyIndex[key];
+    if (e.NumModels++ == 0) {
+        e.LowestId = id;
+    } else if (e.LowestId != MODEL_INVALID) {
+        e.LowestId = std::min(e.LowestId, id);
+    }
+}
+
+static void RemoveFromModelKeyIndex(uint32 key, int32 id) {
+    const auto it = s_ModelKeyIndex.find(key);
+    if (it == s_ModelKeyIndex.end()) {
+        return;
+    }
+    auto& e = it->second;
+    if (--e.NumModels == 0) {
+        s_ModelKeyIndex.erase(it);
+    } else if (e.LowestId == id) {
+        e.LowestId = MODEL_INVALID; // Some other model has this key too, but we don't know which one. Looked up lazily (if ever) in `FindModelIdByKey`
+    }
+}
+
+static void RebuildModelKeyIndex() {
+    s_ModelKeyIndex.clear();
+    s_ModelIdOfInfo.clear();
+    for (auto id = 0; id < CModelInfo::NUM_MODEL_INFOS; id++) {
+        if (const auto mi = CModelInfo::GetModelInfo(id)) {
+            s_ModelIdOfInfo[mi] = id;
+            AddToModelKeyIndex(mi->m_nKey, id);
+        }
+    }
+}
+
+// Linear search for the lowest id of a model with the given key (The vanilla way)
+static int32 FindModelIdByKeyLinear(uint32 key) {
+    for (auto id = 0; id < CModelInfo::NUM_MODEL_INFOS; id++) {
+        if (const auto mi = CModelInfo::GetModelInfo(id); mi && mi->m_nKey == key) {
+            return id;
+        }
+    }
+    return MODEL_INVALID;
+}
+
+// Find the lowest id of a model with the given key, or `MODEL_INVALID` if there are none
+static int32 FindModelIdByKey(uint32 key) {
+    const auto it = s_ModelKeyIndex.find(key);
+    if (it == s_ModelKeyIndex.end()) {
+        // Models may've been registered/renamed behind our back (By unhooked code writing `ms_modelInfoPtrs`/`m_nKey` directly),
+        // so a miss isn't trusted - If the model does exist the index is out of sync and has to be rebuilt.
+        const auto id = FindModelIdByKeyLinear(key);
+        if (id != MODEL_INVALID) {
+            RebuildModelKeyIndex();
+        }
+        return id;
+    }
+    auto& e = it->second;
+    if (e.LowestId == MODEL_INVALID) {
+        e.LowestId = FindModelIdByKeyLinear(key);
+    }
+    const auto mi = e.LowestId != MODEL_INVALID ? CModelInfo::GetModelInfo(e.LowestId) : nullptr;
+    if (!mi || mi->m_nKey != key) { // Key was changed behind our back (By setting `m_nKey` directly)
+        RebuildModelKeyIndex();
+        return FindModelIdByKey(key);
+    }
+    return e.LowestId;
+}
+
+// If there's at most one model with the given key (Call after `FindModelIdByKey`, so the index is up-to-date)
+static bool IsModelKeyUnique(uint32 key) {
+    const auto it = s_ModelKeyIndex.find(key);
+    return it == s_ModelKeyIndex.end() || it->second.NumModels <= 1;
+}
+
 void CModelInfo::InjectHooks()
 {
     RH_ScopedClass(CModelInfo);
@@ -115,6 +198,31 @@ void CModelInfo::ShutDown()
     ms_2dFXInfoStore.m_nCount = 0;
 }
 
+// NOTSA (Inlined)
+void CModelInfo::SetModelInfo(int32 index, CBaseModelInfo* pInfo)
+{
+    if (const auto prev = ms_modelInfoPtrs[index]) {
+        RemoveFromModelKeyIndex(prev->m_nKey, index);
+        s_ModelIdOfInfo.erase(prev);
+    }
+    ms_modelInfoPtrs[index] = pInfo;
+    if (pInfo) {
+        s_ModelIdOfInfo[pInfo] = index;
+        AddToModelKeyIndex(pInfo->m_nKey, index);
+    }
+}
+
+// NOTSA
+void CModelInfo::OnModelKeyChanged(CBaseModelInfo* mi, uint32 oldKey)
+{
+    const auto it = s_ModelIdOfInfo.find(mi);
+    if (it == s_ModelIdOfInfo.end()) { // Not registered (yet)
+        return;
+    }
+    RemoveFromModelKeyIndex(oldKey, it->second);
+    AddToModelKeyIndex(mi->m_nKey, it->second);
+}
+
 // 0x4C6620
 CAtomicModelInfo* CModelInfo::AddAtomicModel(int32 index)
 {
@@ -201,6 +309,8 @@ void CModelInfo::Initialise() {
     ZoneScoped;
 
     memset(ms_modelInfoPtrs, 0, sizeof(ms_modelInfoPtrs));
+    s_ModelKeyIndex.clear(); // NOTSA
+    s_ModelIdOfInfo.clear(); // NOTSA
     ms_damageAtomicModelInfoStore.m_nCount = 0;
     ms_lodAtomicModelInfoStore.m_nCount = 0;
     ms_timeModelInfoStore.m_nCount = 0;
@@ -257,6 +367,21 @@ void CModelInfo::Initialise() {
 CBaseModelInfo* CModelInfo::GetModelInfo(const char* name, int32* index)
 {
     auto iKey = CKeyGen::GetUppercaseKey(name);
+
+    // NOTSA: Use the key index if there's only one model with this name.
+    //        Otherwise which one is found depends on `ms_lastPositionSearched`, so do the original search.
+    const auto id = FindModelIdByKey(iKey);
+    if (id == MODEL_INVALID)
+        return nullptr;
+
+    if (IsModelKeyUnique(iKey)) {
+        ms_lastPositionSearched = id;
+        if (index)
+            *index = id;
+
+        return GetModelInfo(id);
+    }
+
     auto iCurInd = ms_lastPositionSearched;
 
     while (iCurInd < NUM_MODEL_INFOS) {
@@ -295,17 +420,14 @@ CBaseModelInfo* CModelInfo::GetModelInfo(const char* name, int32* index)
 // 0x4C59B0
 CBaseModelInfo* CModelInfo::GetModelInfoFromHashKey(uint32 uiHash, int32* index)
 {
-    for (int32 i = 0; i < NUM_MODEL_INFOS; ++i) {
-        auto mi = GetModelInfo(i);
-        if (mi && mi->m_nKey == uiHash) {
-            if (index)
-                *index = i;
+    const auto id = FindModelIdByKey(uiHash); // NOTSA: Originally a linear search
+    if (id == MODEL_INVALID)
+        return nullptr;
 
-            return mi;
-        }
-    }
+    if (index)
+        *index = id;
 
-    return nullptr;
+    return GetModelInfo(id);
 }
 
 // 0x4C59F0
@@ -326,6 +448,13 @@ CBaseModelInfo* CModelInfo::GetModelInfo(const char* name, int32 minIndex, int32
     if (minIndex > maxIndex)
         return nullptr;
 
+    // NOTSA: Use the key index if we can
+    if (const auto id = FindModelIdByKey(iKey); id == MODEL_INVALID || id > maxIndex) {
+        return nullptr;
+    } else if (id >= minIndex) {
+        return GetModelInfo(id);
+    }
+
     for (int32 i = minIndex; i <= maxIndex; ++i) {
         auto mi = GetModelInfo(i);
         if (mi && mi->m_nKey == iKey)
@@ -92,5 +92,8 @@ public:
     static CBaseModelInfo* GetModelInfo(int32 index) { return ms_modelInfoPtrs[index]; }
     static auto GetPedModelInfo(int32 index) { return GetModelInfo(index)->AsPedModelInfoPtr(); }
     static auto GetVehicleModelInfo(int32 index) { return GetModelInfo(index)->AsVehicleModelInfoPtr(); }
-    static void SetModelInfo(int32 index, CBaseModelInfo* pInfo) { ms_modelInfoPtrs[index] = pInfo; }
+    static void SetModelInfo(int32 index, CBaseModelInfo* pInfo);
+
+    // NOTSA - Must be called whenever the key of a model info changes (See `CBaseModelInfo::SetModelKey`)
+    static void OnModelKeyChanged(CBaseModelInfo* mi, uint32 oldKey);
 };
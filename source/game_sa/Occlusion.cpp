@@ -4,6 +4,19 @@
 #include "Occluder.h"
 #include "ActiveOccluder.h"
 
+#include <bit>
+
+// NOTSA - The active occluders binned into screen-space tiles, built by `ProcessBeforeRendering`.
+// Bit `i` of a tile's mask is set if the on-screen area of `ActiveOccluders[i]` may overlap the tile.
+static constexpr size_t NUM_OCCLUDER_TILES_X = 8;
+static constexpr size_t NUM_OCCLUDER_TILES_Y = 8;
+static_assert(COcclusion::MAX_ACTIVE_OCCLUDERS <= 32, "Tile masks are 32 bits");
+
+static std::array<std::array<uint32, NUM_OCCLUDER_TILES_X>, NUM_OCCLUDER_TILES_Y> s_OccluderTiles{};
+static uint32                                                                   s_OccluderTilesFrame{ UINT32_MAX };
+static size_t                                                                   s_OccluderTilesNumOccluders{};
+static CVector2D                                                                s_OccluderTilesScreenSize{};
+
 void COcclusion::InjectHooks() {
     RH_ScopedClass(COcclusion);
     RH_ScopedCategoryGlobal();
@@ -82,6 +95,90 @@ bool COcclusion::OccluderHidesBehind(CActiveOccluder* first, CActiveOccluder* se
     return true;
 }
 
+// NOTSA - Bounding box of the part of the screen an active occluder may hide (the intersection of its lines' half-planes and the screen)
+static std::optional<std::pair<CVector2D, CVector2D>> GetOnScreenBoundsOfOccluder(const CActiveOccluder& o, CVector2D screenSize) {
+    // Clip the screen's rect with each line (Sutherland-Hodgman)
+    std::array<CVector2D, 4 + std::extent_v<decltype(CActiveOccluder::m_Lines)>> polys[2]{}; // Each line adds at most 1 vertex
+    size_t numVerts{ 4 };
+    polys[0][0] = { 0.f, 0.f };
+    polys[0][1] = { screenSize.x, 0.f };
+    polys[0][2] = { screenSize.x, screenSize.y };
+    polys[0][3] = { 0.f, screenSize.y };
+
+    auto* in  = &polys[0];
+    auto* out = &polys[1];
+    for (auto&& l : o.GetLines()) {
+        size_t numOutVerts{};
+        for (size_t i{}; i < numVerts; i++) {
+            const auto& a  = (*in)[i];
+            const auto& b  = (*in)[(i + 1) % numVerts];
+            const auto  da = DistAlongPerpRightLine2D(l.Origin, l.Dir, a);
+            const auto  db = DistAlongPerpRightLine2D(l.Origin, l.Dir, b);
+            if (da >= 0.f) {
+                (*out)[numOutVerts++] = a;
+            }
+            if ((da >= 0.f) != (db >= 0.f)) {
+                (*out)[numOutVerts++] = lerp(a, b, da / (da - db));
+            }
+        }
+        std::swap(in, out);
+        if (!(numVerts = numOutVerts)) {
+            return std::nullopt;
+        }
+    }
+
+    CVector2D min{ FLT_MAX, FLT_MAX }, max{ -FLT_MAX, -FLT_MAX };
+    for (auto&& v : std::span{ in->data(), numVerts }) {
+        min = { std::min(min.x, v.x), std::min(min.y, v.y) };
+        max = { std::max(max.x, v.x), std::max(max.y, v.y) };
+    }
+    return std::make_pair(min, max);
+}
+
+// NOTSA
+static size_t GetOccluderTileX(float x) { return (size_t)std::clamp((int32)(x / s_OccluderTilesScreenSize.x * (float)NUM_OCCLUDER_TILES_X), 0, (int32)NUM_OCCLUDER_TILES_X - 1); }
+static size_t GetOccluderTileY(float y) { return (size_t)std::clamp((int32)(y / s_OccluderTilesScreenSize.y * (float)NUM_OCCLUDER_TILES_Y), 0, (int32)NUM_OCCLUDER_TILES_Y - 1); }
+
+// NOTSA
+static void BuildOccluderTiles() {
+    for (auto& row : s_OccluderTiles) {
+        row.fill(0);
+    }
+    s_OccluderTilesScreenSize = { SCREEN_WIDTH, SCREEN_HEIGHT };
+    if (s_OccluderTilesScreenSize.x <= 0.f || s_OccluderTilesScreenSize.y <= 0.f) {
+        s_OccluderTilesFrame = UINT32_MAX; // Unusable, check all occluders
+        return;
+    }
+    s_OccluderTilesFrame        = CTimer::GetFrameCounter();
+    s_OccluderTilesNumOccluders = COcclusion::NumActiveOccluders;
+
+    for (auto&& [i, o] : rngv::enumerate(COcclusion::GetActiveOccluders())) {
+        const auto bounds = GetOnScreenBoundsOfOccluder(o, s_OccluderTilesScreenSize);
+        if (!bounds) {
+            continue; // Nothing on screen is hidden by it (Off-screen points aren't looked up in the tiles)
+        }
+        constexpr auto MARGIN = 1.f; // Account for the rounding of the clipping
+        const auto [min, max] = *bounds;
+        for (auto y = GetOccluderTileY(min.y - MARGIN); y <= GetOccluderTileY(max.y + MARGIN); y++) {
+            for (auto x = GetOccluderTileX(min.x - MARGIN); x <= GetOccluderTileX(max.x + MARGIN); x++) {
+                s_OccluderTiles[y][x] |= 1u << i;
+            }
+        }
+    }
+}
+
+// NOTSA - Mask of the active occluders that may hide a point on the screen, or `nullopt` if all of them have to be checked
+static std::optional<uint32> GetOccludersAtScreenPos(CVector2D pos, float radius) {
+    if (   s_OccluderTilesFrame != CTimer::GetFrameCounter()              // Stale (Eg.: `ProcessBeforeRendering`'s hook is disabled)
+        || s_OccluderTilesNumOccluders != COcclusion::NumActiveOccluders
+        || radius < 0.f                                                   // A negative radius lets points outside of an occluder's area pass
+        || !IsPointInRect2D(pos, { 0.f, 0.f }, s_OccluderTilesScreenSize)
+    ) {
+        return std::nullopt;
+    }
+    return s_OccluderTiles[GetOccluderTileY(pos.y)][GetOccluderTileX(pos.x)];
+}
+
 // 0x7200B0
 bool COcclusion::IsPositionOccluded(CVector pos, float radius) {
     if (!NumActiveOccluders) {
@@ -97,11 +194,22 @@ bool COcclusion::IsPositionOccluded(CVector pos, float radius) {
     const auto longEdge     = std::max(scaleX, scaleY);
     const auto screenRadius = radius * longEdge;
     const auto screenDepth  = scrPos.z - radius;
-    return rng::any_of(GetActiveOccluders(), [=](auto&& o) {
+    const auto IsOccludedBy = [=](const CActiveOccluder& o) {
         return o.GetDistToCam() <= screenDepth
             && o.IsPointWithinOcclusionArea(scrPos, screenRadius)
             && o.IsPointBehindOccluder(pos, radius);
-    });
+    };
+
+    // NOTSA: Only check the occluders overlapping the point's tile
+    if (const auto mask = GetOccludersAtScreenPos(scrPos, screenRadius)) {
+        for (auto m = *mask; m; m &= m - 1) {
+            if (IsOccludedBy(ActiveOccluders[std::countr_zero(m)])) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return rng::any_of(GetActiveOccluders(), IsOccludedBy);
 }
 
 // 0x7201C0
@@ -187,4 +295,6 @@ void COcclusion::ProcessBeforeRendering() {
         });
     });
     NumActiveOccluders -= (size_t)(std::distance(b, e));
+
+    BuildOccluderTiles(); // NOTSA
 }
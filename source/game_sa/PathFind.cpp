@@ -6,6 +6,8 @@
 */
 #include "StdInc.h"
 #include "PathFind.h"
+#include "PathRouteCache.h"
+#include "extensions/Configs/PathFind.hpp"
 
 // TODO: Move into the class itself
 CVector& s_pathsNeededPosn = *(CVector*)0x977B70;
@@ -72,7 +74,7 @@ void CPathFind::InjectHooks() {
     //RH_ScopedInstall(Find2NodesForCarCreation, 0x452090);
     //RH_ScopedInstall(TestCoorsCloseness, 0x452000);
     //RH_ScopedInstall(FindNextNodeWandering, 0x451B70);
-    RH_ScopedInstall(DoPathSearch, 0x4515D0, {.reversed = false}); // Sometimes breaks `CTaskComplexFollowNodeRoute::ComputePathNodes` - To repro just walk around in groove st. 
+    RH_ScopedOverloadedInstall(DoPathSearch, "", 0x4515D0, void(CPathFind::*)(ePathType, CVector, CNodeAddress, CVector, CNodeAddress*, int16&, int32, float*, float, CNodeAddress*, float, bool, CNodeAddress, bool, bool), {.reversed = false, .enabled = g_PathFindConfig.UseAStar || g_PathFindConfig.CacheRoutes}); // Sometimes breaks `CTaskComplexFollowNodeRoute::ComputePathNodes` - To repro just walk around in groove st. 
     //RH_ScopedInstall(FindParkingNodeInArea, 0x4513F0);
     RH_ScopedInstall(FindLinkBetweenNodes, 0x451350);
     RH_ScopedInstall(ReturnInteriorNodeIndex, 0x451300);
@@ -306,6 +308,45 @@ void CPathFind::DoPathSearch(
     CNodeAddress forbiddenNodeAddr,
     bool bAllowWaterNodeTransitions,
     bool forBoats
+) {
+    DoPathSearch(
+        pathType,
+        originPos,
+        originAddrAddrHint,
+        targetPos,
+        outResultNodes,
+        outNodesCount,
+        maxNodesToFind,
+        outDistance,
+        maxSearchDistance,
+        targetNodeAddrHint,
+        maxSearchDepth,
+        sameLaneOnly,
+        forbiddenNodeAddr,
+        bAllowWaterNodeTransitions,
+        forBoats,
+        g_PathFindConfig.UseAStar ? ePathSearchAlgorithm::ASTAR : ePathSearchAlgorithm::BUCKETED_DIJKSTRA // NOTSA
+    );
+}
+
+// NOTSA
+void CPathFind::DoPathSearch(
+    ePathType pathType,
+    CVector originPos,
+    CNodeAddress originAddrAddrHint,
+    CVector targetPos,
+    CNodeAddress* outResultNodes,
+    int16& outNodesCount,
+    int32 maxNodesToFind,
+    float* outDistance,
+    float maxSearchDistance,
+    CNodeAddress* targetNodeAddrHint,
+    float maxSearchDepth,
+    bool sameLaneOnly,
+    CNodeAddress forbiddenNodeAddr,
+    bool bAllowWaterNodeTransitions,
+    bool forBoats,
+    ePathSearchAlgorithm algorithm
 ) {
     // Moved this up here, as it's set in every return path
     outNodesCount = 0;
@@ -361,6 +402,40 @@ void CPathFind::DoPathSearch(
         goto fail;
     }
 
+    // NOTSA: Same search as some time before?
+    const auto useCache = g_PathFindConfig.CacheRoutes;
+    const auto cacheKey = notsa::PathRouteCache::Key{
+        .PathType                  = pathType,
+        .Origin                    = origin->GetAddress(),
+        .Target                    = target->GetAddress(),
+        .ForbiddenNode             = forbiddenNodeAddr,
+        .SameLaneOnly              = sameLaneOnly,
+        .AllowWaterNodeTransitions = bAllowWaterNodeTransitions,
+        .ForBoats                  = forBoats,
+        .Algorithm                 = algorithm
+    };
+    if (useCache && notsa::PathRouteCache::Find(cacheKey, outResultNodes, outNodesCount, maxNodesToFind, outDistance, maxSearchDepth)) {
+        return;
+    }
+    const auto StoreRouteInCache = [&](float distance) {
+        if (useCache && outResultNodes && outNodesCount) {
+            const auto route = std::span{ outResultNodes, (size_t)outNodesCount };
+            notsa::PathRouteCache::Store(cacheKey, route, distance, route.back() == target->GetAddress());
+        }
+    };
+
+    if (algorithm == ePathSearchAlgorithm::ASTAR) {
+        float distance{};
+        if (!DoPathSearchAStar(*origin, *target, outResultNodes, outNodesCount, maxNodesToFind, &distance, maxSearchDepth, sameLaneOnly, forbiddenNodeAddr, bAllowWaterNodeTransitions)) {
+            goto fail;
+        }
+        if (outDistance) {
+            *outDistance = distance;
+        }
+        StoreRouteInCache(distance);
+        return;
+    }
+
     rng::fill(m_pathFindHashTable, nullptr);
     m_totalNumNodesInPathFindHashTable = 0u;
 
@@ -376,6 +451,7 @@ void CPathFind::DoPathSearch(
 
     size_t iterDepth{};
     bool finished{};
+    std::optional<float> foundDistance{}; // NOTSA: For the route cache
     while (true) {
         // Dijkstra's algorithm (probably)
 
@@ -395,28 +471,7 @@ void CPathFind::DoPathSearch(
 
                 auto& linked = *GetPathNode(linkedAddr);
 
-                // Omitted the bool variable and instead used `continue`s
-
-                if (sameLaneOnly) { // 0x451814
-                    const auto& naviLinkAddr = m_pNaviLinks[node->m_wAreaId][linkIdx];
-                    if (IsAreaLoaded(naviLinkAddr.m_wAreaId)) {
-                        const auto& naviLink = GetCarPathLink(naviLinkAddr);
-                        if (naviLink.m_attachedTo == linked.GetAddress()) {
-                            if (!naviLink.m_numOppositeDirLanes) {
-                                continue;
-                            }
-                        } else if (!naviLink.m_numSameDirLanes) {
-                            continue;
-                        }
-                    }
-                }
-
-                if (forbiddenNodeAddr == linked.GetAddress()) {
-                    continue;
-                }
-
-                // 0x451885
-                if (node->m_bWaterNode != linked.m_bWaterNode && !bAllowWaterNodeTransitions) {
+                if (!CanPathSearchUseLink(*node, linkIdx, linked, sameLaneOnly, forbiddenNodeAddr, bAllowWaterNodeTransitions)) {
                     continue;
                 }
 
@@ -459,6 +514,7 @@ void CPathFind::DoPathSearch(
         if (outDistance) {
             *outDistance = origin->m_totalDistFromOrigin;
         }
+        foundDistance = origin->m_totalDistFromOrigin; // NOTSA
         if (outResultNodes) { // Weird check really, because below it isn't checked :D
             outResultNodes[outNodesCount++] = origin->GetAddress();
         }
@@ -483,6 +539,219 @@ void CPathFind::DoPathSearch(
     for (auto& addr : aNodesToBeCleared | rng::views::take(numNodesToBeCleared)) {
         GetPathNode(addr)->m_totalDistFromOrigin = SHRT_MAX - 1;
     }
+    if (foundDistance) {
+        StoreRouteInCache(*foundDistance);
+    }
+}
+
+// NOTSA - Code based on 0x451814
+bool CPathFind::CanPathSearchUseLink(const CPathNode& node, size_t linkIdx, const CPathNode& linked, bool sameLaneOnly, CNodeAddress forbiddenNodeAddr, bool bAllowWaterNodeTransitions) {
+    if (sameLaneOnly) { // 0x451814
+        const auto& naviLinkAddr = m_pNaviLinks[node.m_wAreaId][linkIdx];
+        if (IsAreaLoaded(naviLinkAddr.m_wAreaId)) {
+            const auto& naviLink = GetCarPathLink(naviLinkAddr);
+            if (naviLink.m_attachedTo == linked.GetAddress()) {
+                if (!naviLink.m_numOppositeDirLanes) {
+                    return false;
+                }
+            } else if (!naviLink.m_numSameDirLanes) {
+                return false;
+            }
+        }
+    }
+
+    if (forbiddenNodeAddr == linked.GetAddress()) {
+        return false;
+    }
+
+    // 0x451885
+    if (node.m_bWaterNode != linked.m_bWaterNode && !bAllowWaterNodeTransitions) {
+        return false;
+    }
+
+    return true;
+}
+
+// Link lengths are rounded down to bytes, and dynamic links are always 5 units long (See `AddDynamicLinkBetween2Nodes_For1Node`),
+// so a link may well be shorter than the straight-line distance between it's nodes.
+// To keep the heuristic from ever overestimating the straight-line distance is scaled by the lowest length/distance ratio of all loaded links.
+// The ratio is kept per area, and an area's links are only scanned when its link data was (re)allocated - Links into areas
+// loaded later aren't checked, but the links are 2-way, so the same link is checked from the other area once it's loaded.
+// Dynamic links update the ratio of their area right away (See `AddDynamicLinkBetween2Nodes_For1Node`).
+static std::array<float, CPathFind::NUM_TOTAL_PATH_NODE_AREAS>        s_AStarAreaHeuristicScales{};
+static std::array<const uint8*, CPathFind::NUM_TOTAL_PATH_NODE_AREAS> s_AStarHeuristicLinkLengths{}; // `m_pLinkLengths` the area's scale was calculated with
+
+// Lower the scale of the area of `from` to account for a link
+static void UpdateAStarHeuristicScaleWithLink(const CPathFind& pf, const CPathNode& from, CNodeAddress toAddr, uint8 length) {
+    if (!toAddr.IsValid() || !pf.IsAreaNodesAvailable(toAddr)) {
+        return;
+    }
+    const auto& to   = pf.m_pPathNodes[toAddr.m_wAreaId][toAddr.m_wNodeId];
+    const auto  dist = CVector2D::Dist(CVector2D{ from.GetPosition() }, CVector2D{ to.GetPosition() });
+    if (dist > 0.f) {
+        auto& scale = s_AStarAreaHeuristicScales[from.m_wAreaId];
+        scale = std::min(scale, (float)length / dist);
+    }
+}
+
+static float GetAStarHeuristicScale(const CPathFind& pf) {
+    float scale = 1.f;
+    for (auto areaId = 0u; areaId < s_AStarHeuristicLinkLengths.size(); areaId++) {
+        if (!pf.IsAreaLoaded(areaId) || !pf.m_pLinkLengths[areaId]) {
+            continue;
+        }
+        if (s_AStarHeuristicLinkLengths[areaId] != pf.m_pLinkLengths[areaId]) { // (Re)loaded since
+            s_AStarHeuristicLinkLengths[areaId] = pf.m_pLinkLengths[areaId];
+            s_AStarAreaHeuristicScales[areaId]  = 1.f;
+            for (const auto& node : std::span{ pf.m_pPathNodes[areaId], pf.m_anNumNodes[areaId] }) {
+                for (auto linkNum = 0u; linkNum < node.m_nNumLinks; linkNum++) {
+                    const auto linkIdx = node.m_wBaseLinkId + linkNum;
+                    UpdateAStarHeuristicScaleWithLink(pf, node, pf.m_pNodeLinks[areaId][linkIdx], pf.m_pLinkLengths[areaId][linkIdx]);
+                }
+            }
+        }
+        scale = std::min(scale, s_AStarAreaHeuristicScales[areaId]);
+    }
+    return scale * 0.99f; // A little less, in case of float errors
+}
+
+//! Distance of nodes not reached in the current search
+static constexpr int32 ASTAR_UNREACHED = INT32_MAX;
+
+struct AStarNodeState {
+    uint32 Generation{}; //!< `Dist` is only valid if this is the current `s_AStarGeneration`
+    int32  Dist{};       //!< Sum of link lengths from the target
+};
+
+struct AStarHeapEntry {
+    int32        Est;  //!< `Dist` + heuristic
+    int32        Dist; //!< Distance at the time of pushing, if it's different from the node's current one this entry is stale
+    CNodeAddress Addr;
+
+    //! For `std::push_heap`/`std::pop_heap` - Lowest estimate on top
+    friend bool operator<(const AStarHeapEntry& lhs, const AStarHeapEntry& rhs) { return lhs.Est > rhs.Est; }
+};
+
+static std::array<std::vector<AStarNodeState>, NUM_PATH_MAP_AREAS + NUM_PATH_INTERIOR_AREAS> s_AStarNodeStates{}; // Indexed by area, then node id
+static std::vector<AStarHeapEntry>                                                          s_AStarHeap{};
+static uint32                                                                               s_AStarGeneration{};
+
+// NOTSA
+bool CPathFind::DoPathSearchAStar(
+    const CPathNode& origin,
+    const CPathNode& target,
+    CNodeAddress* outResultNodes,
+    int16& outNodesCount,
+    int32 maxNodesToFind,
+    float* outDistance,
+    float maxSearchDepth,
+    bool sameLaneOnly,
+    CNodeAddress forbiddenNodeAddr,
+    bool bAllowWaterNodeTransitions
+) {
+    // New generation, so all distances from the previous search become invalid
+    if (++s_AStarGeneration == 0) {
+        for (auto& states : s_AStarNodeStates) {
+            rng::fill(states, AStarNodeState{});
+        }
+        s_AStarGeneration = 1;
+    }
+    s_AStarHeap.clear();
+
+    const auto GetState = [this](CNodeAddress addr) -> AStarNodeState& {
+        auto& states = s_AStarNodeStates[addr.m_wAreaId];
+        if (states.size() < m_anNumNodes[addr.m_wAreaId]) {
+            states.resize(m_anNumNodes[addr.m_wAreaId]);
+        }
+        return states[addr.m_wNodeId];
+    };
+    const auto GetDist = [&](CNodeAddress addr) {
+        const auto& state = GetState(addr);
+        return state.Generation == s_AStarGeneration ? state.Dist : ASTAR_UNREACHED;
+    };
+
+    // We're searching from the target to the origin (Just like the vanilla search), so the heuristic is the distance to the origin
+    // The heuristic never overestimates, and it's consistent (Going through a link never makes the estimate lower), as links are never shorter than the scaled distance between their nodes
+    const auto originPos      = CVector2D{ origin.GetPosition() };
+    const auto heuristicScale = GetAStarHeuristicScale(*this);
+    const auto Heuristic      = [&](const CPathNode& node) {
+        return (int32)(CVector2D::Dist(CVector2D{ node.GetPosition() }, originPos) * heuristicScale);
+    };
+    const auto Push = [&](const CPathNode& node, int32 dist) {
+        auto& state = GetState(node.GetAddress());
+        state.Generation = s_AStarGeneration;
+        state.Dist       = dist;
+        s_AStarHeap.push_back({ dist + Heuristic(node), dist, node.GetAddress() });
+        std::push_heap(s_AStarHeap.begin(), s_AStarHeap.end());
+    };
+
+    Push(target, 0);
+    while (!s_AStarHeap.empty()) {
+        std::pop_heap(s_AStarHeap.begin(), s_AStarHeap.end());
+        const auto top = s_AStarHeap.back();
+        s_AStarHeap.pop_back();
+
+        // Everything left is on a longer route. (Routes just as long are still expanded, so the route is picked the same way as in the vanilla search)
+        if (GetDist(origin.GetAddress()) < top.Est) {
+            break;
+        }
+        if ((float)top.Est > maxSearchDepth) {
+            break;
+        }
+        if (GetDist(top.Addr) != top.Dist) { // A shorter route to this node was found since pushing it
+            continue;
+        }
+
+        const auto& node = *GetPathNode(top.Addr);
+        for (auto linkNum = 0u; linkNum < node.m_nNumLinks; linkNum++) {
+            const auto linkIdx    = node.m_wBaseLinkId + linkNum;
+            const auto linkedAddr = m_pNodeLinks[node.m_wAreaId][linkIdx];
+            if (!IsAreaNodesAvailable(linkedAddr)) {
+                continue;
+            }
+            const auto& linked = *GetPathNode(linkedAddr);
+            if (!CanPathSearchUseLink(node, linkIdx, linked, sameLaneOnly, forbiddenNodeAddr, bAllowWaterNodeTransitions)) {
+                continue;
+            }
+            if (const auto dist = top.Dist + m_pLinkLengths[node.m_wAreaId][linkIdx]; dist < GetDist(linkedAddr)) {
+                Push(linked, dist);
+            }
+        }
+    }
+
+    const auto originDist = GetDist(origin.GetAddress());
+    if (originDist == ASTAR_UNREACHED || (float)originDist > maxSearchDepth) {
+        return false;
+    }
+
+    // Walk back from the origin, always following the first link that is on a shortest route
+    if (outDistance) {
+        *outDistance = (float)originDist;
+    }
+    if (!outResultNodes) {
+        return true;
+    }
+    outResultNodes[outNodesCount++] = origin.GetAddress();
+    for (auto node = &origin; *node != target && outNodesCount < maxNodesToFind;) {
+        const CPathNode* next{};
+        for (auto linkNum = 0u; linkNum < node->m_nNumLinks; linkNum++) {
+            const auto linkIdx    = node->m_wBaseLinkId + linkNum;
+            const auto linkedAddr = m_pNodeLinks[node->m_wAreaId][linkIdx];
+            if (!IsAreaNodesAvailable(linkedAddr)) {
+                continue;
+            }
+            if (GetDist(node->GetAddress()) - m_pLinkLengths[node->m_wAreaId][linkIdx] == GetDist(linkedAddr)) {
+                next = GetPathNode(linkedAddr);
+                break;
+            }
+        }
+        if (!next) {
+            break;
+        }
+        outResultNodes[outNodesCount++] = next->GetAddress();
+        node = next;
+    }
+    return true;
 }
 
 // 0x452760
@@ -493,6 +762,7 @@ void CPathFind::ComputeRoute(uint8 nodeType, const CVector& vecStart, const CVec
 // 0x44D960
 void CPathFind::SetLinksBridgeLights(float fXMin, float fXMax, float fYMin, float fYMax, bool value) {
     const auto areaRect = CRect{ {fXMin, fYMin}, {fXMax, fYMax} };
+    notsa::PathRouteCache::InvalidateRoutesInBox({ fXMin, fYMin, -FLT_MAX }, { fXMax, fYMax, FLT_MAX }); // NOTSA
     for (auto areaId = 0u; areaId < NUM_PATH_MAP_AREAS; areaId++) {
         if (!IsAreaLoaded(areaId)) {
             continue;
@@ -580,12 +850,15 @@ void CPathFind::MarkRoadNodeAsDontWander(float x, float y, float z) {
     auto node = FindNodeClosestToCoors(pos, PATH_TYPE_VEH, 999999.88f, 0, 0, 0, 0, 0);
     if (node.IsValid()) {
         m_pPathNodes[node.m_wAreaId][node.m_wNodeId].m_bDontWander = true;
+        const auto nodePos = GetPathNode(node)->GetPosition();
+        notsa::PathRouteCache::InvalidateRoutesInBox(nodePos, nodePos); // NOTSA
     }
 }
 
 // 0x452820
 void CPathFind::SwitchRoadsOffInAreaForOneRegion(float xMin, float xMax, float yMin, float yMax, float zMin, float zMax, bool bLowTraffic, uint8 nodeType, int32 areaId,
                                                  uint8 bUnused) {
+    notsa::PathRouteCache::InvalidateRoutesInBox({ xMin, yMin, zMin }, { xMax, yMax, zMax }); // NOTSA
     return plugin::CallMethod<0x452820, CPathFind*, float, float, float, float, float, float, bool, char, int32, bool>(this, xMin, xMax, yMin, yMax, zMin, zMax, bLowTraffic,
                                                                                                                        nodeType, areaId, bUnused);
 }
@@ -615,6 +888,7 @@ void CPathFind::LoadPathFindData(int32 areaId) {
 
 // 0x4529F0
 void CPathFind::LoadPathFindData(RwStream* stream, int32 areaId) {
+    notsa::PathRouteCache::InvalidateAll(); // NOTSA: Routes through the new area may be shorter than the cached ones
     RwStreamRead(stream, &m_anNumNodes[areaId],        sizeof(m_anNumNodes[areaId]));
     RwStreamRead(stream, &m_anNumVehicleNodes[areaId], sizeof(m_anNumVehicleNodes[areaId]));
     RwStreamRead(stream, &m_anNumPedNodes[areaId],     sizeof(m_anNumPedNodes[areaId]));
@@ -674,6 +948,7 @@ void CPathFind::LoadPathFindData(RwStream* stream, int32 areaId) {
 
 // 0x44D0F0
 void CPathFind::UnLoadPathFindData(int32 index) {
+    notsa::PathRouteCache::InvalidateRoutesInArea(index); // NOTSA
     delete[] m_pPathNodes[index];
     delete[] m_pNaviNodes[index];
     delete[] m_pNodeLinks[index];
@@ -886,6 +1161,7 @@ CNodeAddress CPathFind::FindNearestExteriorNodeToInteriorNode(int32 interiorId)
 // 0x44E000
 void CPathFind::AddDynamicLinkBetween2Nodes_For1Node(CNodeAddress first, CNodeAddress second) {
     assert(IsAreaNodesAvailable(first));
+    notsa::PathRouteCache::InvalidateAll(); // NOTSA: The new link may make routes shorter
 
     auto& firstPathInfo = m_pPathNodes[first.m_wAreaId][first.m_wNodeId];
     auto numAddresses = m_anNumAddresses[first.m_wAreaId];
@@ -925,6 +1201,10 @@ void CPathFind::AddDynamicLinkBetween2Nodes_For1Node(CNodeAddress first, CNodeAd
     m_pPathIntersections[first.m_wAreaId][firstLinkId + firstPathInfo.m_nNumLinks].Clear();
     firstPathInfo.m_nNumLinks++;
     firstPathInfo.m_wBaseLinkId = firstLinkId;
+
+    if (s_AStarHeuristicLinkLengths[first.m_wAreaId] == m_pLinkLengths[first.m_wAreaId]) { // NOTSA: The new link may be shorter than the A* heuristic's estimate (If the area wasn't scanned yet, it'll be included once it is)
+        UpdateAStarHeuristicScaleWithLink(*this, firstPathInfo, second, 5);
+    }
 }
 
 // 0x44D230
@@ -1094,6 +1374,7 @@ void CPathFind::RemoveInterior(uint32 intId) {
         if (m_interiorIDs[intSlot] != intId) {
             continue;
         }
+        notsa::PathRouteCache::InvalidateRoutesInArea(intSlotAreaId); // NOTSA
 
         for (auto areaId = 0u; areaId < NUM_TOTAL_PATH_NODE_AREAS; areaId++) {
             for (auto& node : GetPathNodesInArea(areaId, PATH_TYPE_PED)) {
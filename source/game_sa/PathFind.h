@@ -27,6 +27,15 @@ enum ePathType : uint8 {
     PATH_TYPE_ALL /// @notsa
 };
 
+/*!
+* @notsa
+* @brief Search algorithm used by `CPathFind::DoPathSearch`
+*/
+enum class ePathSearchAlgorithm : uint8 {
+    BUCKETED_DIJKSTRA, ///< Vanilla - Dijkstra over the distance buckets of `m_pathFindHashTable`
+    ASTAR,             ///< A* (Straight-line distance heuristic, binary heap), see `CPathFind::DoPathSearchAStar`
+};
+
 enum eTrafficLevel {
     TRAFFIC_FULL = 0,
     TRAFFIC_HIGH = 1,
@@ -350,6 +359,59 @@ public:
         bool includeNodesWithoutLinks,
         bool waterPath
     ); 
+
+    /*!
+    * @notsa
+    * @brief Same as the other overload, but the search algorithm can be selected. The routes found are the same, unless there are multiple equally long ones.
+    */
+    void DoPathSearch(
+        ePathType pathType,
+        CVector originPos,
+        CNodeAddress originAddrAddr,
+        CVector targetPos,
+        CNodeAddress* outResultNodes,
+        int16& outNodesCount,
+        int32 maxNodesToFind,
+        float* outDistance,
+        float maxSearchDistance,
+        CNodeAddress* targetNodeAddr,
+        float maxUnkLimit,
+        bool oneSideOnly,
+        CNodeAddress forbiddenNodeAddr,
+        bool includeNodesWithoutLinks,
+        bool waterPath,
+        ePathSearchAlgorithm algorithm
+    );
+
+    /*!
+    * @notsa
+    * @brief A* from `target` to `origin` - Used by `DoPathSearch` with `ePathSearchAlgorithm::ASTAR`
+    *
+    * Distances are kept in a side table stamped with a search generation (instead of `m_totalDistFromOrigin`), so nothing has to be cleared afterwards.
+    * The heuristic is the straight-line distance, scaled down so that no loaded link is shorter than the scaled distance between it's nodes (See `GetAStarHeuristicScale`),
+    * thus it never overestimates, and the route found is just as short as the vanilla search's. (A short link between far away nodes, eg.: a dynamic one, makes it a lot less effective though)
+    * All nodes that may be on a shortest route are expanded, so the route is picked the same way as by the vanilla search when distances tie.
+    *
+    * @return Whenever a route was found
+    */
+    bool DoPathSearchAStar(
+        const CPathNode& origin,
+        const CPathNode& target,
+        CNodeAddress* outResultNodes,
+        int16& outNodesCount,
+        int32 maxNodesToFind,
+        float* outDistance,
+        float maxSearchDepth,
+        bool sameLaneOnly,
+        CNodeAddress forbiddenNodeAddr,
+        bool bAllowWaterNodeTransitions
+    );
+
+    /*!
+    * @notsa
+    * @brief Whenever the search may go from `node` to `linked` (The `linkIdx`th link of `node`'s area) - Used by `DoPathSearch`
+    */
+    bool CanPathSearchUseLink(const CPathNode& node, size_t linkIdx, const CPathNode& linked, bool sameLaneOnly, CNodeAddress forbiddenNodeAddr, bool bAllowWaterNodeTransitions);
     void ComputeRoute(uint8 nodeType, const CVector& vecStart, const CVector& vecEnd, const CNodeAddress& startAddress, CNodeRoute* route);
     void SetLinksBridgeLights(float fXMin, float fXMax, float fYMin, float fYMax, bool bTrainCrossing);
 
@@ -0,0 +1,100 @@
+#include "StdInc.h"
+#include <bitset>
+
+#include "PathRouteCache.h"
+#include "PathFind.h"
+
+namespace notsa {
+struct PathRouteCacheEntry {
+    bool                      m_IsValid{};
+    bool                      m_IsComplete{};
+    PathRouteCache::Key       m_Key{};
+    float                     m_Distance{};
+    std::vector<CNodeAddress> m_Route{};
+    CVector                   m_BoundsMin{}, m_BoundsMax{}; //!< Bounding box of the route's nodes
+    std::bitset<CPathFind::NUM_TOTAL_PATH_NODE_AREAS> m_Areas{}; //!< Areas of the route's nodes
+};
+
+static constexpr size_t NUM_CACHED_ROUTES = 256; // Must be a power of 2
+
+static std::array<PathRouteCacheEntry, NUM_CACHED_ROUTES> s_CachedRoutes{};
+
+static PathRouteCacheEntry& GetEntryOfKey(const PathRouteCache::Key& key) {
+    const auto HashAddr = [](CNodeAddress addr) {
+        return ((uint32)addr.m_wAreaId << 16) | addr.m_wNodeId;
+    };
+    auto h = HashAddr(key.Origin) * 0x9E3779B1u;
+    h ^= HashAddr(key.Target) + 0x7F4A7C15u + (h << 6) + (h >> 2);
+    h ^= HashAddr(key.ForbiddenNode) + (h << 6) + (h >> 2);
+    h ^= (uint32)key.PathType | (uint32)key.SameLaneOnly << 8 | (uint32)key.AllowWaterNodeTransitions << 9 | (uint32)key.ForBoats << 10 | (uint32)key.Algorithm << 11;
+    h ^= h >> 16;
+    return s_CachedRoutes[h & (NUM_CACHED_ROUTES - 1)];
+}
+
+bool PathRouteCache::Find(const Key& key, CNodeAddress* outNodes, int16& outNodesCount, int32 maxNodesToFind, float* outDistance, float maxSearchDepth) {
+    const auto& e = GetEntryOfKey(key);
+    if (   !e.m_IsValid
+        || e.m_Key != key
+        || e.m_Distance > maxSearchDepth                                   // The search would've given up before reaching the origin
+        || !e.m_IsComplete && (int32)e.m_Route.size() < maxNodesToFind // More nodes are wanted than what we have
+    ) {
+        s_NumMisses++;
+        return false;
+    }
+    s_NumHits++;
+
+    if (outNodes) {
+        outNodesCount = (int16)std::min<int32>((int32)e.m_Route.size(), maxNodesToFind);
+        rng::copy(e.m_Route | rngv::take(outNodesCount), outNodes);
+    }
+    if (outDistance) {
+        *outDistance = e.m_Distance;
+    }
+    return true;
+}
+
+void PathRouteCache::Store(const Key& key, std::span<const CNodeAddress> route, float distance, bool isComplete) {
+    auto& e = GetEntryOfKey(key);
+    e.m_IsValid    = true;
+    e.m_IsComplete = isComplete;
+    e.m_Key        = key;
+    e.m_Distance   = distance;
+    e.m_Route.assign(route.begin(), route.end());
+
+    e.m_BoundsMin = CVector{ FLT_MAX, FLT_MAX, FLT_MAX };
+    e.m_BoundsMax = CVector{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    e.m_Areas.reset();
+    for (const auto addr : route) { // The route was just found, so all of it's nodes are loaded
+        const auto pos = ThePaths.GetPathNode(addr)->GetPosition();
+        e.m_BoundsMin = CVector{ std::min(e.m_BoundsMin.x, pos.x), std::min(e.m_BoundsMin.y, pos.y), std::min(e.m_BoundsMin.z, pos.z) };
+        e.m_BoundsMax = CVector{ std::max(e.m_BoundsMax.x, pos.x), std::max(e.m_BoundsMax.y, pos.y), std::max(e.m_BoundsMax.z, pos.z) };
+        e.m_Areas.set(addr.m_wAreaId);
+    }
+}
+
+void PathRouteCache::InvalidateRoutesInBox(const CVector& min, const CVector& max) {
+    for (auto& e : s_CachedRoutes) {
+        if (   e.m_IsValid
+            && e.m_BoundsMin.x <= max.x && e.m_BoundsMax.x >= min.x
+            && e.m_BoundsMin.y <= max.y && e.m_BoundsMax.y >= min.y
+            && e.m_BoundsMin.z <= max.z && e.m_BoundsMax.z >= min.z
+        ) {
+            e.m_IsValid = false;
+        }
+    }
+}
+
+void PathRouteCache::InvalidateRoutesInArea(size_t areaId) {
+    for (auto& e : s_CachedRoutes) {
+        if (e.m_IsValid && e.m_Areas.test(areaId)) {
+            e.m_IsValid = false;
+        }
+    }
+}
+
+void PathRouteCache::InvalidateAll() {
+    for (auto& e : s_CachedRoutes) {
+        e.m_IsValid = false;
+    }
+}
+}; // namespace notsa
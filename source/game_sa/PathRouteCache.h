@@ -0,0 +1,61 @@
+#pragma once
+
+#include <span>
+
+#include "NodeAddress.h"
+
+enum ePathType : uint8;
+enum class ePathSearchAlgorithm : uint8;
+
+namespace notsa {
+/*!
+* @brief NOTSA - Cache of the routes found by `CPathFind::DoPathSearch`, so repeated searches between the same 2 nodes (Traffic, peds following routes, etc) are free.
+*
+* @brief Direct-mapped by the hash of the key - A colliding route simply replaces the previous one.
+* @brief Only routes that were found are cached, and they're invalidated whenever something (that may) change them happens (See the `Invalidate*` functions' callers in `PathFind.cpp`)
+* @brief Each route keeps the bounding box and the areas of it's nodes, so invalidation doesn't have to look at the nodes themselves.
+*/
+class PathRouteCache {
+public:
+    struct Key {
+        ePathType            PathType;
+        CNodeAddress         Origin, Target; //!< The resolved nodes (Not the hints)
+        CNodeAddress         ForbiddenNode;
+        bool                 SameLaneOnly;
+        bool                 AllowWaterNodeTransitions;
+        bool                 ForBoats;
+        ePathSearchAlgorithm Algorithm; //!< Algorithms may pick different routes when distances tie
+
+        bool operator==(const Key&) const = default;
+    };
+
+    /*!
+    * @brief Look up a route, and copy it into the output arguments (Same as `DoPathSearch` would)
+    * @return Whenever it was found. If not, the output arguments are left untouched.
+    */
+    static bool Find(const Key& key, CNodeAddress* outNodes, int16& outNodesCount, int32 maxNodesToFind, float* outDistance, float maxSearchDepth);
+
+    /*!
+    * @brief Store a route found by `DoPathSearch`
+    * @param route      The nodes, starting with the origin
+    * @param isComplete Whenever the route ends at the target (As opposed to being cut short by `maxNodesToFind`)
+    */
+    static void Store(const Key& key, std::span<const CNodeAddress> route, float distance, bool isComplete);
+
+    //! Drop all routes whose bounding box intersects the given box (That is, the routes that may go through a node inside it)
+    static void InvalidateRoutesInBox(const CVector& min, const CVector& max);
+
+    //! Drop all routes going through nodes of an area
+    static void InvalidateRoutesInArea(size_t areaId);
+
+    //! Drop all routes
+    static void InvalidateAll();
+
+    static uint32 GetNumHits()   { return s_NumHits; }
+    static uint32 GetNumMisses() { return s_NumMisses; }
+    static void   ResetCounters() { s_NumHits = s_NumMisses = 0; }
+
+private:
+    static inline uint32 s_NumHits{}, s_NumMisses{};
+};
+}; // namespace notsa
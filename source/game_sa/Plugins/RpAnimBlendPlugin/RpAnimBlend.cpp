@@ -1,5 +1,7 @@
 #include "StdInc.h"
 
+#include <execution>
+
 #include "RpAnimBlend.h"
 
 static uint32& ClumpOffset = *(uint32*)0xB5F878;
@@ -609,6 +611,7 @@ struct AnimBlendUpdateData { // OG name
                                            //!< Each entry is incremented on each call of the appropriate `FrameUpdateCallBack`
                                            //!< So that on every call they point to the blend node of the given frame
                                            //!< (This works because the sequences are sorted the same way as the frames apprear in the clump)
+    CAnimBlendClumpData* ClumpData{};      //!< NOTSA: Used instead of `gpAnimBlendClump` by the frame update functions below, so different clumps can be updated on different threads
 };
 
 static auto& gpAnimBlendClump = StaticRef<CAnimBlendClumpData*>(0xB4EA0C);
@@ -1628,7 +1631,7 @@ void FrameUpdateCallBackT(AnimBlendFrameData* fd, AnimBlendUpdateData* c) {
     if (!fd->KeyFramesIgnoreNodeTranslation) {
         // Apply velocity
         if constexpr (ExtractVelocity) {
-            const auto wsPos = gpAnimBlendClump->m_PedPosition;
+            const auto wsPos = c->ClumpData->m_PedPosition;
 
             wsPos->x = nextV.x - currV.x;
             wsPos->y = nextV.y - currV.y;
@@ -1704,7 +1707,7 @@ void FrameUpdateCallBackW(AnimBlendFrameData* fd, void* data) {
         }
     }
 #else
-    if (fd->HasVelocity && gpAnimBlendClump->m_PedPosition) {
+    if (fd->HasVelocity && c->ClumpData->m_PedPosition) {
         if (fd->HasZVelocity) { // NOTE: Originally compressed anims immediately did 3D velocity, so this flag may not be set on compressed anims?
             FrameUpdateCallBackT<IsCompressed, IsSkinned, true, true>(fd, c);
         } else {
@@ -1720,7 +1723,7 @@ void FrameUpdateCallBackW(AnimBlendFrameData* fd, void* data) {
 void FrameUpdateCallBackOffscreen(AnimBlendFrameData* fd, void* data) {
     const auto c = static_cast<AnimBlendUpdateData*>(data);
 
-    if (fd->HasVelocity && gpAnimBlendClump->m_PedPosition) {
+    if (fd->HasVelocity && c->ClumpData->m_PedPosition) {
 #if USE_COPY_PASTE_FRAME_UPDATE
         FrameUpdateCallBackSkinnedWithVelocityExtraction(c, fd);
 #else
@@ -1738,7 +1741,7 @@ void RpAnimBlendNodeUpdateKeyFrames(AnimBlendUpdateData* c, AnimBlendFrameData*
         for (size_t frameN = 0; frameN < nFrames; frameN++) {
             const auto fd = &frames[frameN];
 
-            if (fd->HasVelocity && gpAnimBlendClump->m_PedPosition) {
+            if (fd->HasVelocity && c->ClumpData->m_PedPosition) {
                 continue;
             }
 
@@ -1752,24 +1755,37 @@ void RpAnimBlendNodeUpdateKeyFrames(AnimBlendUpdateData* c, AnimBlendFrameData*
     }
 }
 
-// 0x4D34F0
-void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float timeStep, bool isOnScreen) {
-    const auto bd = RpAnimBlendClumpGetData(clump);
+//! NOTSA: State of a clump's animation update carried between the stages of `RpAnimBlendClumpUpdateAnimations`
+struct AnimBlendClumpUpdateState {
+    RpClump*            Clump{};
+    float               TimeStep{};
+    bool                IsOnScreen{};
+    float               AnimTimeMult{};
+    AnimBlendUpdateData Ctx{};
+};
+
+// NOTSA: 1st stage of `RpAnimBlendClumpUpdateAnimations` - Update the blend and time step of the associations (May call anim callbacks)
+// Returns false if the clump has no animations to update
+static bool BeginClumpAnimUpdate(AnimBlendClumpUpdateState& s) {
+    const auto clump = s.Clump;
+    const auto bd    = RpAnimBlendClumpGetData(clump);
 
     if (bd->m_AnimList.IsEmpty()) {
-        return;
+        return false;
     }
 
     gpAnimBlendClump = bd;
 
-    AnimBlendUpdateData ctx{};
-    size_t             nodesCnt{};
+    auto&  ctx = s.Ctx;
+    size_t nodesCnt{};
+
+    ctx.ClumpData = bd;
 
     float totalTime{}, totalBlendAmnt{};
 
     // 0x4D351F
     RpAnimBlendClumpForEachAssociation(clump, [&](CAnimBlendAssociation* a) {
-        if (!a->UpdateBlend(timeStep)) {
+        if (!a->UpdateBlend(s.TimeStep)) {
             return;
         }
         const auto ah = a->GetHier();
@@ -1790,13 +1806,23 @@ void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float timeStep, bool isOnS
     ctx.BlendNodeArrays[nodesCnt] = nullptr; // Null terminator
 
     // 0x4D35A2 - Update animation's timesteps
-    const auto animTimeMult = totalTime == 0.f
+    s.AnimTimeMult = totalTime == 0.f
         ? 1.f
         : 1.f / totalTime * totalBlendAmnt;
     RpAnimBlendClumpForEachAssociation(clump, [&](CAnimBlendAssociation* a) {
-        a->UpdateTimeStep(timeStep, animTimeMult);
+        a->UpdateTimeStep(s.TimeStep, s.AnimTimeMult);
     });
 
+    return true;
+}
+
+// NOTSA: 2nd stage of `RpAnimBlendClumpUpdateAnimations` - Interpolate the key-frames of all frames
+// Only touches the data of the clump (and it's ped's position), so different clumps may be updated in parallel
+static void UpdateClumpAnimFrames(AnimBlendClumpUpdateState& s) {
+    const auto clump = s.Clump;
+    const auto bd    = s.Ctx.ClumpData;
+    const auto ctx   = &s.Ctx;
+
     // 0x4D360E - Update all animations's frames
     const auto rootFD = &bd->GetRootFrameData();
     rootFD->IsUpdatingFrame = true;
@@ -1806,33 +1832,107 @@ void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float timeStep, bool isOnS
             IsClumpSkinned(clump)
                 ? &FrameUpdateCallBackW<true, true>   // FrameUpdateCallBackCompressedSkinned
                 : &FrameUpdateCallBackW<true, false>, // FrameUpdateCallBackCompressedNonSkinned
-            &ctx
+            ctx
         );
-    } else if (isOnScreen) {
+    } else if (s.IsOnScreen) {
         if (rootFD->NeedsKeyFrameUpdate) {
-            RpAnimBlendNodeUpdateKeyFrames(&ctx, bd->m_FrameDatas, bd->m_NumFrameData);
+            RpAnimBlendNodeUpdateKeyFrames(ctx, bd->m_FrameDatas, bd->m_NumFrameData);
         }
 
         bd->ForAllFrames(
             IsClumpSkinned(clump)
                 ? FrameUpdateCallBackW<false, true>   // FrameUpdateCallBackSkinned
                 : FrameUpdateCallBackW<false, false>, // FrameUpdateCallBackNonSkinned
-            &ctx
+            ctx
         );
 
         rootFD->NeedsKeyFrameUpdate = false;
     } else {
-        bd->ForAllFrames(FrameUpdateCallBackOffscreen, &ctx);
+        bd->ForAllFrames(FrameUpdateCallBackOffscreen, ctx);
         rootFD->NeedsKeyFrameUpdate = true;
     }
+}
 
+// NOTSA: 3rd stage of `RpAnimBlendClumpUpdateAnimations` - Advance the time of the associations (May call anim callbacks) and update the frame's objects
+static void EndClumpAnimUpdate(AnimBlendClumpUpdateState& s) {
     // 0x4D3715 - Update all animation's times
-    RpAnimBlendClumpForEachAssociation(clump, [&](CAnimBlendAssociation* a) {
-        a->UpdateTime(timeStep, animTimeMult);
+    RpAnimBlendClumpForEachAssociation(s.Clump, [&](CAnimBlendAssociation* a) {
+        a->UpdateTime(s.TimeStep, s.AnimTimeMult);
     });
     
     // 0x4D3764
-    RwFrameUpdateObjects(RpClumpGetFrame(clump));
+    RwFrameUpdateObjects(RpClumpGetFrame(s.Clump));
+}
+
+// 0x4D34F0
+void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float timeStep, bool isOnScreen) {
+    AnimBlendClumpUpdateState s{
+        .Clump      = clump,
+        .TimeStep   = timeStep,
+        .IsOnScreen = isOnScreen,
+    };
+    if (!BeginClumpAnimUpdate(s)) {
+        return;
+    }
+    UpdateClumpAnimFrames(s);
+    EndClumpAnimUpdate(s);
+}
+
+// NOTSA
+static constexpr size_t MIN_CLUMPS_TO_UPDATE_IN_PARALLEL = 16; // Below this the overhead of the thread pool isn't worth it
+
+// NOTSA: Whenever updating the clump's animations may call an anim callback
+// The callbacks may do anything (eg.: delete the associations of other clumps), so the clump can't be updated together with others
+static bool MayClumpAnimUpdateCallBack(RpClump* clump) {
+    bool mayCallBack{};
+    RpAnimBlendClumpForEachAssociation(clump, [&](CAnimBlendAssociation* a) {
+        if (a->m_nCallbackType != ANIM_BLEND_CALLBACK_NONE && a->m_pCallbackFunc != CDefaultAnimCallback::DefaultAnimCB) {
+            mayCallBack = true;
+        }
+    });
+    return mayCallBack;
+}
+
+// NOTSA
+void RpAnimBlendClumpUpdateAnimationsParallel(std::span<const RpAnimBlendClumpUpdateArgs> clumps) {
+    static std::vector<AnimBlendClumpUpdateState> s_States{};
+    s_States.clear();
+
+    // Finish the update of the clumps begun so far
+    const auto FlushStates = [&] {
+        // Stage 2 - Each clump is done by a single thread, so the results don't depend on the scheduling
+        if (s_States.size() >= MIN_CLUMPS_TO_UPDATE_IN_PARALLEL) {
+            std::for_each(std::execution::par, s_States.begin(), s_States.end(), UpdateClumpAnimFrames);
+        } else {
+            rng::for_each(s_States, UpdateClumpAnimFrames);
+        }
+
+        // Stage 3 - In order again
+        rng::for_each(s_States, EndClumpAnimUpdate);
+
+        s_States.clear();
+    };
+
+    for (const auto& args : clumps) {
+        // A callback could free the data of the clumps begun so far (eg.: The associations referenced by `AnimBlendUpdateData::BlendNodeArrays`),
+        // so their update is finished first, and then this clump is updated on it's own - Just like `RpAnimBlendClumpUpdateAnimations` would.
+        if (MayClumpAnimUpdateCallBack(args.Clump)) {
+            FlushStates();
+            RpAnimBlendClumpUpdateAnimations(args.Clump, args.TimeStep, args.IsOnScreen);
+            continue;
+        }
+
+        // Stage 1 - In order, same as calling `RpAnimBlendClumpUpdateAnimations` one-by-one (No callbacks, so it doesn't touch other clumps)
+        AnimBlendClumpUpdateState s{
+            .Clump      = args.Clump,
+            .TimeStep   = args.TimeStep,
+            .IsOnScreen = args.IsOnScreen,
+        };
+        if (BeginClumpAnimUpdate(s)) {
+            s_States.emplace_back(s);
+        }
+    }
+    FlushStates();
 }
 
 // 0x4D60E0
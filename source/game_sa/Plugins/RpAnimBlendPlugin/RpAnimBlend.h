@@ -272,6 +272,23 @@ void RpAnimBlendClumpSetBlendDeltas(RpClump* clump, uint32 flags, float blendDel
 */
 void RpAnimBlendClumpUpdateAnimations(RpClump* clump, float step, bool onScreen);
 
+//! NOTSA: Arguments of `RpAnimBlendClumpUpdateAnimations` for `RpAnimBlendClumpUpdateAnimationsParallel`
+struct RpAnimBlendClumpUpdateArgs {
+    RpClump* Clump;
+    float    TimeStep;
+    bool     IsOnScreen;
+};
+
+/*!
+ * @notsa
+ * @brief Same as calling `RpAnimBlendClumpUpdateAnimations` for each clump, but the key-frame interpolation of the clumps is done on multiple threads.
+ * @brief The results don't depend on the number of threads, and are the same as the serial version's:
+ * @brief Clumps that have associations with anim callbacks are updated on their own, after finishing the update of all clumps before them.
+ * @brief (As a callback could do anything, eg.: delete the associations of other clumps)
+ * @param clumps The clumps to update (in the order they'd be updated one-by-one)
+*/
+void RpAnimBlendClumpUpdateAnimationsParallel(std::span<const RpAnimBlendClumpUpdateArgs> clumps);
+
 /*!
  * @addr 0x4D60E0
  * @brief R* hacking
@@ -3,6 +3,7 @@
 #include "Commands.hpp"
 #include <CommandParser/Parser.hpp>
 #include <functional>
+#include "SwitchJumpTableCache.h"
 
 /*
 * Basic language feature commands (Comparasions, assingments, etc...)
@@ -113,6 +114,55 @@ auto GoToSub(CRunningScript& S, int32 goToAddress) { // 0x050
     S.UpdatePC(goToAddress);
 }
 
+//
+// SWITCH
+//
+
+//! Jump to the label picked by `CTheScripts::UseSwitchJumpTable` (If any)
+void JumpUsingSwitchJumpTable(CRunningScript& S) {
+    int32 label;
+    CTheScripts::UseSwitchJumpTable(label);
+    if (label) {
+        S.UpdatePC(label);
+    }
+}
+
+//! Add the cases in the command's case slots to `CTheScripts::SwitchJumpTable`, then jump if it was the last command of the statement
+void AddSwitchCasesAndJump(CRunningScript& S, size_t numSlots) {
+    S.CollectParameters((int16)(numSlots * 2));
+    for (auto i = 0u; i < numSlots; i++) {
+        if (CTheScripts::NumberOfEntriesStillToReadForSwitch > 0) {
+            CTheScripts::AddToSwitchJumpTable(ScriptParams[i * 2].iParam, ScriptParams[i * 2 + 1].iParam);
+            CTheScripts::NumberOfEntriesStillToReadForSwitch--;
+        }
+    }
+    if (CTheScripts::NumberOfEntriesStillToReadForSwitch == 0) {
+        JumpUsingSwitchJumpTable(S);
+    }
+}
+
+auto SwitchStart(CRunningScript& S, int32 value) { // 0x871
+    // NOTSA: Use the statement's compiled jump table (Instead of rebuilding it from the commands each time)
+    if (const auto& table = notsa::script::SwitchJumpTableCache::Get(S.m_IP); table.IsCompiled) {
+        S.m_IP = table.EndIP;
+        if (const auto label = table.GetLabelOf(value)) {
+            S.UpdatePC(label);
+        }
+        return;
+    }
+
+    S.CollectParameters(3);
+    CTheScripts::ValueToCheckInSwitchStatement       = value;
+    CTheScripts::NumberOfEntriesStillToReadForSwitch = ScriptParams[0].iParam;
+    CTheScripts::SwitchDefaultExists                 = ScriptParams[1].bParam;
+    CTheScripts::SwitchDefaultAddress                = ScriptParams[2].iParam;
+    AddSwitchCasesAndJump(S, 7);
+}
+
+auto SwitchContinued(CRunningScript& S) { // 0x872
+    AddSwitchCasesAndJump(S, 9);
+}
+
 //
 // RETURN
 //
@@ -372,6 +422,8 @@ void notsa::script::commands::basic::RegisterHandlers() {
     REGISTER_COMMAND_HANDLER(COMMAND_ABS_LVAR_FLOAT, AbsStore<float>);
 
     REGISTER_COMMAND_HANDLER(COMMAND_GOTO, GoTo);
+    REGISTER_COMMAND_HANDLER(COMMAND_SWITCH_START, SwitchStart);
+    REGISTER_COMMAND_HANDLER(COMMAND_SWITCH_CONTINUED, SwitchContinued);
     //REGISTER_COMMAND_HANDLER(COMMAND_GOTO_IF_FALSE, GoToIfFalse);
     REGISTER_COMMAND_HANDLER(COMMAND_GOSUB,  GoToSub);
     REGISTER_COMMAND_HANDLER(COMMAND_RETURN_TRUE, ReturnTrue);
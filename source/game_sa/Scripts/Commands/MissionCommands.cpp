@@ -28,6 +28,7 @@ void LoadAndLaunchMissionInternal(int32 missionId) {
             CFileMgr::Seek(file, offsetToMission, 0);
             const auto bytesRead = CFileMgr::Read(file, &CTheScripts::MissionBlock[0], MISSION_SCRIPT_SIZE);
             CFileMgr::CloseFile(file);
+            CTheScripts::InvalidateCachedScriptCode(CTheScripts::MissionBlock.data(), CTheScripts::MissionBlock.size()); // NOTSA
 
             CTheScripts::WipeLocalVariableMemoryForMissionScript();
             CRunningScript* script = CTheScripts::StartNewScript(&CTheScripts::MissionBlock[0]);
@@ -33,6 +33,18 @@ static notsa::log_ptr logger;
 //! Holds all custom command handlers (or null for commands with no custom handler)
 static inline std::array<notsa::script::CommandHandlerFunction, (size_t)(COMMAND_HIGHEST_ID_TO_HOOK) + 1> s_CustomCommandHandlerTable{};
 
+//! NOTSA: Flat dispatch table used by `ProcessOneCommand` - Holds the custom handler of every command, or `ProcessOriginalCommand` for ones that don't have one (See `UpdateCommandHandlerTable`)
+static inline std::array<notsa::script::CommandHandlerFunction, (size_t)(COMMAND_HIGHEST_ID_TO_HOOK) + 1> s_CommandHandlerTable{};
+
+//! NOTSA: Dispatch a command with no custom handler to the game's handler of it's chunk of 100 commands
+static OpcodeResult ProcessOriginalCommand(CRunningScript* S) {
+    const auto cmd = (eScriptCommands)(reinterpret_cast<const scm::Instruction*>(S->m_IP)[-1].Command); // The IP is already past the instruction
+    if ((size_t)cmd > COMMAND_HIGHEST_VANILLA_ID) { // The game has no handler for these (It'd be an out-of-bounds access)
+        return notsa::script::detail::NotImplemented(*S, cmd);
+    }
+    return std::invoke(CRunningScript::s_OriginalCommandHandlerTable[(size_t)cmd / 100], S, cmd);
+}
+
 std::array<std::array<char, COMMANDS_CHAR_BUFFER_SIZE>, COMMANDS_CHAR_BUFFERS_COUNT> CRunningScript::ScriptArgCharBuffers        = {};
 uint8                                                                                CRunningScript::ScriptArgCharNextFreeBuffer = 0;
 
@@ -146,6 +158,10 @@ void CRunningScript::InjectCustomCommandHooks() {
     NOTSA_LOG_DEBUG("Script cmds dumped! Find them in `<GTA Directory>/Scripts`!");
     NOTSA_LOG_DEBUG("Script cmds reverse progress: {}/{} ({:.2f}% done)", reversed, total, 100.0f * ((float)reversed / (float)total));
 #endif
+
+    for (auto id = 0u; id < s_CommandHandlerTable.size(); id++) {
+        UpdateCommandHandlerTable((eScriptCommands)(id));
+    }
 }
 
 // 0x4648E0
@@ -883,11 +899,13 @@ OpcodeResult CRunningScript::ProcessOneCommand() {
 
     const auto op = GetAtIPAs<scm::Instruction>();
 
+#ifdef NOTSA_DEBUG
     // Check if IP is valid pre-return
     notsa::ScopeGuard guardIP{[this]() {
         const auto next{ GetAtIPAs<scm::Instruction>(false) };
         VERIFY(next.Command <= COMMAND_HIGHEST_VANILLA_ID);
     }};
+#endif
 
 #ifdef NOTSA_SCRIPT_TRACING
     // snprintf is faster (in debug at least) - Gotta stick to it for now
@@ -899,11 +917,12 @@ OpcodeResult CRunningScript::ProcessOneCommand() {
     
     m_NotFlag = op.NotFlag;
 
-    if (const auto handler = CustomCommandHandlerOf((eScriptCommands)(op.Command))) {
-        return std::invoke(handler, this);
-    } else {
-        return std::invoke(s_OriginalCommandHandlerTable[(size_t)op.Command / 100], this, (eScriptCommands)(op.Command));
+    // NOTSA: Single indirect call, instead of checking for a custom handler first
+    if ((size_t)op.Command >= s_CommandHandlerTable.size()) { // Not a command we know about (Corrupt script, or an IP gone astray)
+        return ProcessOriginalCommand(this);
     }
+    assert(s_CommandHandlerTable[(size_t)op.Command]); // Not registered? (See `UpdateCommandHandlerTable`)
+    return s_CommandHandlerTable[(size_t)op.Command](this);
 }
 
 // 0x469F00
@@ -954,6 +973,11 @@ notsa::script::CommandHandlerFunction& CRunningScript::CustomCommandHandlerOf(eS
     return s_CustomCommandHandlerTable[(size_t)(command)];
 }
 
+void CRunningScript::UpdateCommandHandlerTable(eScriptCommands command) {
+    const auto custom = CustomCommandHandlerOf(command);
+    s_CommandHandlerTable[(size_t)(command)] = custom ? custom : &ProcessOriginalCommand;
+}
+
 void CRunningScript::ResetIP() {
     assert(m_StackDepth > 0); // Original bug...
     do {
@@ -351,6 +351,9 @@ public:
     //! Return the custom command handler of a function (or null) as a reference
     static notsa::script::CommandHandlerFunction& CustomCommandHandlerOf(eScriptCommands command); // Returning a ref here for convenience (instead of having to make a `Set` function too)
 
+    //! NOTSA: Update the command's entry in the dispatch table used by `ProcessOneCommand` - Must be called after changing it's custom handler (See `CustomCommandHandlerOf`)
+    static void UpdateCommandHandlerTable(eScriptCommands command);
+
 private:
     void ResetIP();
 };
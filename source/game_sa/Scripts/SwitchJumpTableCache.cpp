@@ -0,0 +1,112 @@
+#include "StdInc.h"
+
+#include "SwitchJumpTableCache.h"
+
+namespace notsa {
+namespace script {
+static std::unordered_map<const uint8*, SwitchJumpTableCache::JumpTable> s_JumpTables{};
+
+//! Read a constant integer parameter, or return null if it isn't one
+static std::optional<int32> ReadConstant(uint8*& ip) {
+    switch (CTheScripts::Read1ByteFromScript(ip)) {
+    case SCRIPT_PARAM_STATIC_INT_8BITS:
+        return CTheScripts::Read1ByteFromScript(ip);
+    case SCRIPT_PARAM_STATIC_INT_16BITS:
+        return CTheScripts::Read2BytesFromScript(ip);
+    case SCRIPT_PARAM_STATIC_INT_32BITS:
+        return CTheScripts::Read4BytesFromScript(ip);
+    default:
+        return std::nullopt;
+    }
+}
+
+//! Read the cases of the statement the same way the vanilla handlers do (`SWITCH_START` has 7 case slots, `SWITCH_CONTINUED` has 9)
+static SwitchJumpTableCache::JumpTable CompileJumpTable(uint8* ip) {
+    SwitchJumpTableCache::JumpTable table{};
+
+    const auto numCases = ReadConstant(ip);
+    const auto hasDefault = ReadConstant(ip);
+    const auto defaultLabel = ReadConstant(ip);
+    if (!numCases || !hasDefault || !defaultLabel) {
+        return table;
+    }
+    if (*numCases <= 0 || *numCases > MAX_NUM_SwitchJumpTable) { // Let the vanilla handlers deal with it, whatever happens then
+        return table;
+    }
+    table.DefaultLabel = *defaultLabel;
+
+    auto numCasesLeft = *numCases;
+    const auto ReadCases = [&](size_t numSlots) {
+        for (auto i = 0u; i < numSlots; i++) {
+            const auto value = ReadConstant(ip);
+            const auto label = ReadConstant(ip);
+            if (!value || !label) {
+                return false;
+            }
+            if (numCasesLeft > 0) {
+                table.Cases.push_back({ .m_nSwitchValue = *value, .m_nSwitchLabelAddress = *label });
+                numCasesLeft--;
+            }
+        }
+        return true;
+    };
+    if (!ReadCases(7)) {
+        return table;
+    }
+    while (numCasesLeft > 0) {
+        const auto& op = *reinterpret_cast<const scm::Instruction*>(ip);
+        if (op.Command != COMMAND_SWITCH_CONTINUED || op.NotFlag) {
+            return table;
+        }
+        ip += sizeof(scm::Instruction);
+        if (!ReadCases(9)) {
+            return table;
+        }
+    }
+
+    table.EndIP      = ip;
+    table.IsCompiled = true;
+    return table;
+}
+
+int32 SwitchJumpTableCache::JumpTable::GetLabelOf(int32 value) const {
+    auto ptr1 = 0u;
+    auto ptr2 = Cases.size() - 1u;
+    while (ptr2 - ptr1 > 1) {
+        const auto idx = (ptr1 + ptr2) / 2;
+        if (Cases[idx].m_nSwitchValue == value) {
+            return Cases[idx].m_nSwitchLabelAddress;
+        }
+        if (value <= Cases[idx].m_nSwitchValue) {
+            ptr2 = idx;
+        } else {
+            ptr1 = idx;
+        }
+    }
+    for (const auto idx : { ptr2, ptr1 }) {
+        if (Cases[idx].m_nSwitchValue == value) {
+            return Cases[idx].m_nSwitchLabelAddress;
+        }
+    }
+    return DefaultLabel;
+}
+
+const SwitchJumpTableCache::JumpTable& SwitchJumpTableCache::Get(uint8* ip) {
+    auto it = s_JumpTables.find(ip);
+    if (it == s_JumpTables.end()) {
+        it = s_JumpTables.emplace(ip, CompileJumpTable(ip)).first;
+    }
+    return it->second;
+}
+
+void SwitchJumpTableCache::InvalidateRange(const uint8* begin, size_t size) {
+    std::erase_if(s_JumpTables, [=](const auto& kv) {
+        return kv.first >= begin && kv.first < begin + size;
+    });
+}
+
+void SwitchJumpTableCache::InvalidateAll() {
+    s_JumpTables.clear();
+}
+}; // namespace script
+}; // namespace notsa
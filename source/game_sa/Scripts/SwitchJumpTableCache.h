@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include "TheScripts.h"
+
+namespace notsa {
+namespace script {
+/*!
+* @brief NOTSA - Jump tables of `SWITCH_START` statements, compiled the first time the statement is executed, and cached by IP.
+*
+* @brief The vanilla handlers refill `CTheScripts::SwitchJumpTable` with the cases
+* @brief (read from the `SWITCH_START` and following `SWITCH_CONTINUED` commands) every time the statement is executed.
+*
+* @brief The cache must be invalidated whenever script code is overwritten/freed (See `CTheScripts::InvalidateCachedScriptCode`)
+*/
+class SwitchJumpTableCache {
+public:
+    struct JumpTable {
+        bool                           IsCompiled{};   //!< If false the statement couldn't be compiled (Eg.: A case isn't a constant) and has to be executed the vanilla way
+        std::vector<tScriptSwitchCase> Cases{};        //!< In the order they're in the script (Same as in `CTheScripts::SwitchJumpTable`)
+        int32                          DefaultLabel{}; //!< Label to jump to if no case matches - Same as vanilla, it's used even if the statement has no default case
+        uint8*                         EndIP{};        //!< IP after the last `SWITCH_CONTINUED` of the statement
+
+        //! Get the label to jump to for a value (0 if none) - Same search as `CTheScripts::UseSwitchJumpTable`, so unsorted/duplicate cases pick the same label
+        int32 GetLabelOf(int32 value) const;
+    };
+
+    /*!
+    * @brief Get the jump table of a statement, compiled if it isn't cached yet
+    * @param ip IP of the `SWITCH_START`'s parameters following the value to switch on
+    */
+    static const JumpTable& Get(uint8* ip);
+
+    //! Drop the tables of all statements in the given range of memory
+    static void InvalidateRange(const uint8* begin, size_t size);
+
+    //! Drop everything
+    static void InvalidateAll();
+};
+}; // namespace script
+}; // namespace notsa
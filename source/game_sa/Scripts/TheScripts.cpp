@@ -10,6 +10,7 @@
 #include "LoadingScreen.h"
 #include "Scripted2dEffects.h"
 #include "Shadows.h"
+#include "SwitchJumpTableCache.h"
 #include "VehicleRecording.h"
 #include "TaskComplexLeaveAnyCar.h"
 #include "TaskComplexWander.h"
@@ -105,6 +106,7 @@ void CTheScripts::InjectHooks() {
 // 0x468D50
 void CTheScripts::Init() {
     rng::fill(ScriptSpace, 0u);
+    InvalidateCachedScriptCode(); // NOTSA
     rng::fill(LocalVariablesForCurrentMission, tScriptParam{});
 
     CRunningScript* nextScript = nullptr;
@@ -1621,6 +1623,16 @@ void CTheScripts::UseSwitchJumpTable(int32& switchLabelAddress) {
     CheckEntryAndJump(nullptr); // Jump to the default case
 }
 
+// NOTSA
+void CTheScripts::InvalidateCachedScriptCode(const uint8* begin, size_t size) {
+    notsa::script::SwitchJumpTableCache::InvalidateRange(begin, size);
+}
+
+// NOTSA
+void CTheScripts::InvalidateCachedScriptCode() {
+    notsa::script::SwitchJumpTableCache::InvalidateAll();
+}
+
 // 0x4646D0
 void CTheScripts::PrintListSizes() {
     auto active{ 0u }, idle{ 0u };
@@ -543,6 +543,12 @@ public:
     static void UndoBuildingSwaps();
     static void UndoEntityInvisibilitySettings();
     static void UseSwitchJumpTable(int32& switchLabelAddress);
+
+    //! NOTSA: Drop everything cached about script code in the given range of memory (Must be called when code there is overwritten/freed)
+    static void InvalidateCachedScriptCode(const uint8* begin, size_t size);
+
+    //! NOTSA: Drop everything cached about script code
+    static void InvalidateCachedScriptCode();
     static void WipeLocalVariableMemoryForMissionScript();
 
     static bool HasCarModelBeenSuppressed(eModelID carModelId);
@@ -0,0 +1,144 @@
+#include "StdInc.h"
+
+#include <bit>
+
+#include "SectorBuildingArray.h"
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+#define NOTSA_SECTOR_BUILDING_ARRAY_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace notsa {
+static std::array<SectorBuildingArray, MAX_SECTORS> s_SectorBuildingArrays{};
+static std::vector<CBuilding*>                       s_FoundBuildings{}; // Result of the last `GetBuildings*` call - Shared by all arrays, so the queries aren't reentrant
+
+static SectorBuildingArray& GetArrayOfSector(const CSector& sector) {
+    const auto idx = &sector - &CWorld::ms_aSectors[0][0];
+    assert(idx >= 0 && idx < MAX_SECTORS);
+    return s_SectorBuildingArrays[idx];
+}
+
+SectorBuildingArray& SectorBuildingArray::Get(const CSector& sector) {
+    auto& arr = GetArrayOfSector(sector);
+    if (!arr.m_IsValid) {
+        arr.Rebuild(sector.m_buildings);
+    }
+    return arr;
+}
+
+void SectorBuildingArray::Invalidate(const CSector& sector) {
+    GetArrayOfSector(sector).m_IsValid = false;
+}
+
+void SectorBuildingArray::InvalidateAll() {
+    for (auto& arr : s_SectorBuildingArrays) {
+        arr.m_IsValid = false;
+    }
+}
+
+void SectorBuildingArray::InvalidateSectorsOf(CEntity& entity) {
+    if (entity.m_bIsBIGBuilding) { // These are in the LOD lists, not the sectors
+        return;
+    }
+
+    // Same sectors as `CEntity::Add`/`CEntity::Remove`
+    auto rect = entity.GetBoundRect();
+    rect.left   = std::max(rect.left, -3000.f);
+    rect.right  = std::min(rect.right, 2999.f);
+    rect.bottom = std::max(rect.bottom, -3000.f);
+    rect.top    = std::min(rect.top, 2999.f);
+    for (auto y = CWorld::GetSectorY(rect.bottom); y <= CWorld::GetSectorY(rect.top); y++) {
+        for (auto x = CWorld::GetSectorX(rect.left); x <= CWorld::GetSectorX(rect.right); x++) {
+            Invalidate(*GetSector(x, y));
+        }
+    }
+}
+
+std::span<CBuilding* const> SectorBuildingArray::GetBuildingsTouchingLine(const CColLine& line) {
+    const auto& s = line.m_vecStart;
+    const auto  d = line.m_vecEnd - line.m_vecStart;
+    const auto  invDirSq = 1.f / std::max(d.SquaredMagnitude(), FLT_EPSILON);
+
+    s_FoundBuildings.clear();
+
+    size_t i = 0;
+#ifdef NOTSA_SECTOR_BUILDING_ARRAY_SSE
+    // Same as the scalar loop below, but for 4 spheres at once
+    const auto sx = _mm_set1_ps(s.x), sy = _mm_set1_ps(s.y), sz = _mm_set1_ps(s.z);
+    const auto dx = _mm_set1_ps(d.x), dy = _mm_set1_ps(d.y), dz = _mm_set1_ps(d.z);
+    const auto invDirSqV = _mm_set1_ps(invDirSq), zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f);
+    for (; i + 4 <= m_Buildings.size(); i += 4) {
+        const auto cx = _mm_sub_ps(_mm_loadu_ps(&m_BoundX[i]), sx);
+        const auto cy = _mm_sub_ps(_mm_loadu_ps(&m_BoundY[i]), sy);
+        const auto cz = _mm_sub_ps(_mm_loadu_ps(&m_BoundZ[i]), sz);
+        const auto dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, dx), _mm_mul_ps(cy, dy)), _mm_mul_ps(cz, dz));
+        const auto t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(dot, invDirSqV), zero), one);
+        const auto ex = _mm_sub_ps(cx, _mm_mul_ps(dx, t));
+        const auto ey = _mm_sub_ps(cy, _mm_mul_ps(dy, t));
+        const auto ez = _mm_sub_ps(cz, _mm_mul_ps(dz, t));
+        const auto distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), _mm_mul_ps(ez, ez));
+        const auto r = _mm_loadu_ps(&m_BoundRadius[i]);
+        for (auto mask = (uint32)_mm_movemask_ps(_mm_cmple_ps(distSq, _mm_mul_ps(r, r))); mask; mask &= mask - 1) {
+            s_FoundBuildings.push_back(m_Buildings[i + std::countr_zero(mask)]);
+        }
+    }
+#endif
+    for (; i < m_Buildings.size(); i++) {
+        // Closest point of the line to the sphere's center
+        const auto cx = m_BoundX[i] - s.x, cy = m_BoundY[i] - s.y, cz = m_BoundZ[i] - s.z;
+        const auto t  = std::clamp((cx * d.x + cy * d.y + cz * d.z) * invDirSq, 0.f, 1.f);
+        const auto ex = cx - d.x * t, ey = cy - d.y * t, ez = cz - d.z * t;
+        if (ex * ex + ey * ey + ez * ez <= sq(m_BoundRadius[i])) {
+            s_FoundBuildings.push_back(m_Buildings[i]);
+        }
+    }
+    return s_FoundBuildings;
+}
+
+std::span<CBuilding* const> SectorBuildingArray::GetBuildingsInRange(const CVector& point, float radius, bool b2D) {
+    const auto radiusSq = sq(radius);
+
+    s_FoundBuildings.clear();
+    for (size_t i = 0; i < m_Buildings.size(); i++) {
+        const auto dx = m_PosX[i] - point.x, dy = m_PosY[i] - point.y, dz = b2D ? 0.f : m_PosZ[i] - point.z;
+        if (dx * dx + dy * dy + dz * dz <= radiusSq) {
+            s_FoundBuildings.push_back(m_Buildings[i]);
+        }
+    }
+    return s_FoundBuildings;
+}
+
+void SectorBuildingArray::Rebuild(const CPtrListSingleLink<CBuilding*>& list) {
+    m_Buildings.clear();
+    for (auto* const v : { &m_PosX, &m_PosY, &m_PosZ, &m_BoundX, &m_BoundY, &m_BoundZ, &m_BoundRadius }) {
+        v->clear();
+    }
+
+    for (auto node = list.GetNode(); node; node = node->Next) {
+        auto* const building = node->Item;
+
+        const auto& pos = building->GetPosition();
+        m_PosX.push_back(pos.x);
+        m_PosY.push_back(pos.y);
+        m_PosZ.push_back(pos.z);
+
+        // Use a sphere enclosing the bounding box, as that's what `CCollision::ProcessLineOfSight` checks against
+        CVector centre = pos;
+        float   radius = FLT_MAX; // No collision (yet), so it can't be rejected
+        if (auto* const cm = building->GetColModel()) {
+            const auto& bb = cm->GetBoundingBox();
+            centre = building->TransformFromObjectSpace(bb.GetCenter());
+            radius = bb.GetSize().Magnitude() / 2.f + 0.01f; // Some leeway for float errors
+        }
+        m_BoundX.push_back(centre.x);
+        m_BoundY.push_back(centre.y);
+        m_BoundZ.push_back(centre.z);
+        m_BoundRadius.push_back(radius);
+
+        m_Buildings.push_back(building);
+    }
+
+    m_IsValid = true;
+}
+}; // namespace notsa
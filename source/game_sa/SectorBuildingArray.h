@@ -0,0 +1,61 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "PtrListSingleLink.h"
+#include "Sector.h"
+
+class CBuilding;
+class CEntity;
+class CColLine;
+class CVector;
+
+namespace notsa {
+/*!
+* @brief NOTSA - Contiguous copy of a sector's building list (`CSector::m_buildings`),
+* @brief with the positions and bounding spheres of the buildings stored next to each other (SoA)
+*
+* @brief The list is still the real storage (The game's code uses it as well), this is only used
+* @brief by world queries to reject buildings without touching the entities (and the list's nodes) themselves.
+* @brief Buildings don't move, so the array only has to be rebuilt when a building is added/removed (See `CEntity::Add`, `CEntity::Remove`),
+* @brief deleted (See `CEntity::~CEntity`) or its model is changed (See `CBuilding::ReplaceWithNewModel`).
+*
+* @brief The queries return their result in a buffer shared by all arrays, so they aren't reentrant (nor thread safe).
+*/
+class SectorBuildingArray {
+public:
+    //! Get the array of a sector, rebuilt if it's outdated
+    static SectorBuildingArray& Get(const CSector& sector);
+
+    //! Mark the array of a sector outdated
+    static void Invalidate(const CSector& sector);
+
+    //! Mark the arrays of all sectors outdated
+    static void InvalidateAll();
+
+    //! Mark the arrays of the sectors the building is in outdated - Must be called when a building is changed (or deleted) while it's in the world
+    static void InvalidateSectorsOf(CEntity& entity);
+
+    /*!
+    * @brief Get the buildings whose bounding sphere (enclosing their collision's bounding box) the line touches
+    * @return The buildings, valid until the next call of any of the `GetBuildings*` functions (of any array)
+    */
+    std::span<CBuilding* const> GetBuildingsTouchingLine(const CColLine& line);
+
+    /*!
+    * @brief Get the buildings whose position is in the given range of the point
+    * @return The buildings, valid until the next call of any of the `GetBuildings*` functions (of any array)
+    */
+    std::span<CBuilding* const> GetBuildingsInRange(const CVector& point, float radius, bool b2D);
+
+private:
+    void Rebuild(const CPtrListSingleLink<CBuilding*>& list);
+
+private:
+    bool                             m_IsValid{};
+    std::vector<CBuilding*>          m_Buildings{};
+    std::vector<float>               m_PosX{}, m_PosY{}, m_PosZ{};                         //!< Positions of the buildings
+    std::vector<float>               m_BoundX{}, m_BoundY{}, m_BoundZ{}, m_BoundRadius{}; //!< Bounding spheres of the buildings
+};
+}; // namespace notsa
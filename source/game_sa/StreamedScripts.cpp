@@ -34,6 +34,7 @@ void CStreamedScripts::LoadStreamedScript(RwStream* stream, int32 index) {
 
         scr.m_StreamedScriptMemory = new uint8[scr.m_SizeInBytes];
         RwStreamRead(stream, scr.m_StreamedScriptMemory, scr.m_SizeInBytes);
+        CTheScripts::InvalidateCachedScriptCode(scr.m_StreamedScriptMemory, scr.m_SizeInBytes); // NOTSA: May have been allocated where a freed script was
     }
 }
 
@@ -78,6 +79,9 @@ const char* CStreamedScripts::GetStreamedScriptFilename(uint16 index) {
 
 // 0x4708E0
 void CStreamedScripts::RemoveStreamedScriptFromMemory(int32 index) {
+    if (const auto mem = m_aScripts[index].m_StreamedScriptMemory) {
+        CTheScripts::InvalidateCachedScriptCode(mem, m_aScripts[index].m_SizeInBytes); // NOTSA
+    }
     delete[] std::exchange(m_aScripts[index].m_StreamedScriptMemory, nullptr);
 }
 
@@ -7,6 +7,7 @@
 #include "TheScripts.h"
 #include "LoadingScreen.h"
 #include "VehicleRecording.h"
+#include "extensions/Configs/Streaming.hpp"
 
 size_t& CStreaming::ms_memoryAvailable = *reinterpret_cast<size_t*>(0x8A5A80); // 25'600'000 == 25.6 MB
 uint32& CStreaming::desiredNumVehiclesLoaded = *reinterpret_cast<uint32*>(0x8A5A84);
@@ -68,6 +69,60 @@ bool& CStreaming::m_bLoadingAllRequestedModels = *reinterpret_cast<bool*>(0x9655
 bool& CStreaming::m_bModelStreamNotLoaded = *reinterpret_cast<bool*>(0x9654C4);
 static int32& CurrentGangMemberToLoad = *(int32*)0x9654D4;
 
+// NOTSA - Requested models ordered by their position on the CD, so that `GetNextFileOnCd` doesn't have to go through the whole requested list.
+// Models are added in `RequestModel`, and removed lazily (once `GetNextFileOnCd` finds them to not be requested anymore).
+// Models at the same offset are ordered newest first, just like in the requested list (New requests are added at the beginning of it).
+struct StreamingRequestQueueEntry {
+    uint32 Offset;  //!< See `GetRequestCdOffset`
+    uint32 InvSeq;  //!< `UINT32_MAX` minus the no. of requests made before this one
+    int32  ModelId;
+
+    auto operator<=>(const StreamingRequestQueueEntry&) const = default;
+};
+static std::set<StreamingRequestQueueEntry>                                      s_RequestQueue;
+static std::array<std::optional<StreamingRequestQueueEntry>, RESOURCE_ID_TOTAL> s_RequestQueueEntryOfModel;
+static uint32                                                                    s_RequestQueueSeq{};
+
+// NOTSA - The offset `GetNextFileOnCd` orders models by
+static uint32 GetRequestCdOffset(int32 modelId) {
+    const auto pos = CStreaming::GetInfo(modelId).GetCdPosn();
+    return notsa::IsFixBugs() // CD_STREAM_READ_POS_FIX
+        ? pos.Offset // NB: Use correct value (Instead of including the handle too)
+        : pos.ToInt();
+}
+
+// NOTSA
+static void AddToRequestQueue(int32 modelId) {
+    auto& entry = s_RequestQueueEntryOfModel[modelId];
+    if (entry) {
+        s_RequestQueue.erase(*entry);
+    }
+    entry = StreamingRequestQueueEntry{ GetRequestCdOffset(modelId), UINT32_MAX - s_RequestQueueSeq++, modelId };
+    s_RequestQueue.insert(*entry);
+}
+
+// NOTSA - Add models in the requested list that aren't in the queue. Returns if there were any.
+// Needed because only `RequestModel` adds to the queue, so models added to the list by unhooked code would never be found by `GetNextFileOnCd`.
+static bool SyncRequestQueueWithRequestedList() {
+    bool anyAdded{};
+    for (auto info = CStreaming::ms_pStartRequestedList->GetNext(); info != CStreaming::ms_pEndRequestedList; info = info->GetNext()) {
+        const auto modelId = (int32)CStreaming::GetModelFromInfo(info);
+        if (!s_RequestQueueEntryOfModel[modelId]) {
+            NOTSA_LOG_WARN("Requested model {} wasn't in the request queue", modelId);
+            AddToRequestQueue(modelId);
+            anyAdded = true;
+        }
+    }
+    return anyAdded;
+}
+
+// NOTSA
+static void ClearRequestQueue() {
+    s_RequestQueue.clear();
+    rng::fill(s_RequestQueueEntryOfModel, std::nullopt);
+    s_RequestQueueSeq = 0;
+}
+
 RwStream& gRwStream = *reinterpret_cast<RwStream*>(0x8E48AC);
 
 void CStreaming::InjectHooks() {
@@ -386,14 +441,10 @@ int32 CStreaming::GetDiscInDrive() {
 int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
     ZoneScoped;
 
-    uint32 nextRequestModelOffset  = UINT32_MAX;
-    uint32 firstRequestModelOffset = UINT32_MAX;
-    int32  firstRequestModelId    = MODEL_INVALID;
-    int32  nextRequestModelId     = MODEL_INVALID;
-    for (auto info = ms_pStartRequestedList->GetNext(); info != ms_pEndRequestedList; info = info->GetNext()) {
-        const auto modelId = GetModelFromInfo(info);
-        if (bNotPriority && ms_numPriorityRequests != 0 && !info->IsPriorityRequest())
-            continue;
+    // Returns if the model can be loaded now, requests it's dependencies if they're missing
+    const auto CanLoadModelNow = [&](int32 modelId) {
+        if (bNotPriority && ms_numPriorityRequests != 0 && !GetInfo(modelId).IsPriorityRequest())
+            return false;
 
         // Additional conditions for some model types (DFF, TXD, IFP)
         switch (GetModelType(modelId)) {
@@ -404,7 +455,7 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
             const auto txdModel = TXDToModelId(modelInfo->m_nTxdIndex);
             if (!GetInfo(txdModel).IsLoadedOrBeingRead()) {
                 RequestModel(txdModel, GetInfo(modelId).GetFlags()); // Request TXD for this DFF
-                continue;
+                return false;
             }
 
             // Check if it has an anim (IFP), if so, make sure it gets loaded
@@ -413,7 +464,7 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
                 const int32 animModelId = IFPToModelId(animFileIndex);
                 if (!GetInfo(animModelId).IsLoadedOrBeingRead()) {
                     RequestModel(animModelId, STREAMING_KEEP_IN_MEMORY);
-                    continue;
+                    return false;
                 }
             }
             break;
@@ -426,7 +477,7 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
                 const int32 parentModelIdx = TXDToModelId(parentIndex);
                 if (!GetInfo(parentModelIdx).IsLoadedOrBeingRead()) {
                     RequestModel(parentModelIdx, STREAMING_KEEP_IN_MEMORY);
-                    continue;
+                    return false;
                 }
             }
             break;
@@ -434,30 +485,72 @@ int32 CStreaming::GetNextFileOnCd(uint32 streamLastPosn, bool bNotPriority) {
         case eModelType::IFP: {
             if (CCutsceneMgr::IsCutsceneProcessing() || !GetInfo(MODEL_MALE01).IsLoaded()) {
                 // Skip in this case
-                continue;
+                return false;
             }
             break;
         }
         }
+        return true;
+    };
 
-        const auto pos = GetInfo(modelId).GetCdPosn();
-        const uint32 offset = notsa::IsFixBugs() // CD_STREAM_READ_POS_FIX
-            ? pos.Offset // NB: Use correct value (Instead of including the handle too)
-            : pos.ToInt();
-        if (offset < firstRequestModelOffset) {
-            firstRequestModelOffset = offset;
-            firstRequestModelId     = modelId;
+    // NOTSA: Originally the whole requested list was searched for the loadable model with the lowest offset
+    //        at or after `streamLastPosn` (or if there's none, with the lowest offset overall).
+    //        Instead, the request queue (which is ordered by the offset) is searched from `streamLastPosn` onwards,
+    //        wrapping around, and the first loadable model is picked.
+    //        Requests made during the search are ignored, as those would've been added before the iterator in the list.
+    // NOTE:  Unlike the original, `CanLoadModelNow` isn't called for the models after the picked one, so
+    //        their missing TXD/IFP/parent TXD dependencies (which are requested in `RequestModel` already, but may have been removed since)
+    //        are only re-requested once the search gets to them. As dependencies are re-requested when they're needed,
+    //        this only changes the order they're loaded in, and thus the models picked later on.
+    auto lastInvSeqOfNewRequests = UINT32_MAX - s_RequestQueueSeq;
+    const auto FindFirstLoadableModel = [&](auto it, auto&& IsInRange) {
+        while (it != s_RequestQueue.end() && IsInRange(*it)) {
+            const auto entry = *it;
+            if (entry.InvSeq <= lastInvSeqOfNewRequests) { // Requested during this search
+                ++it;
+                continue;
+            }
+            if (s_RequestQueueEntryOfModel[entry.ModelId] != entry || !GetInfo(entry.ModelId).IsRequested()) { // Stale entry
+                if (s_RequestQueueEntryOfModel[entry.ModelId] == entry) {
+                    s_RequestQueueEntryOfModel[entry.ModelId] = std::nullopt;
+                }
+                it = s_RequestQueue.erase(it);
+                continue;
+            }
+            if (GetRequestCdOffset(entry.ModelId) != entry.Offset) { // CD position has changed since the request, re-sort it
+                it = s_RequestQueue.erase(it);
+                auto& newEntry = s_RequestQueueEntryOfModel[entry.ModelId];
+                newEntry = StreamingRequestQueueEntry{ GetRequestCdOffset(entry.ModelId), entry.InvSeq, entry.ModelId };
+                s_RequestQueue.insert(*newEntry);
+                continue;
+            }
+            if (CanLoadModelNow(entry.ModelId)) {
+                return entry.ModelId;
+            }
+            ++it;
         }
-
-        if (offset < nextRequestModelOffset && offset >= streamLastPosn) {
-            nextRequestModelOffset = offset;
-            nextRequestModelId     = modelId;
+        return (int32)MODEL_INVALID;
+    };
+    const auto FindNextModel = [&] {
+        const auto modelId = FindFirstLoadableModel(
+            s_RequestQueue.lower_bound({ streamLastPosn, 0, INT32_MIN }),
+            [](auto&&) { return true; }
+        );
+        if (modelId != MODEL_INVALID) {
+            return modelId;
         }
+        return FindFirstLoadableModel(
+            s_RequestQueue.begin(),
+            [&](const StreamingRequestQueueEntry& e) { return e.Offset < streamLastPosn; }
+        );
+    };
+    int32 nextModelId = FindNextModel();
+    if (nextModelId == MODEL_INVALID && SyncRequestQueueWithRequestedList()) {
+        // Models were requested behind our back (By unhooked code adding them to the list directly), search again with them included
+        lastInvSeqOfNewRequests = UINT32_MAX - s_RequestQueueSeq;
+        nextModelId = FindNextModel();
     }
 
-    const int32 nextModelId = nextRequestModelId == MODEL_INVALID
-        ? firstRequestModelId
-        : nextRequestModelId;
     if (nextModelId != MODEL_INVALID || ms_numPriorityRequests == 0) {
         return nextModelId;
     }
@@ -1501,6 +1594,7 @@ void CStreaming::RequestModel(int32 modelId, int32 streamingFlags) {
         }
         }
         info.AddToList(ms_pStartRequestedList);
+        AddToRequestQueue(modelId); // NOTSA
 
         ++ms_numModelsRequested;
         if (streamingFlags & STREAMING_PRIORITY_REQUEST)
@@ -1798,7 +1892,13 @@ void CStreaming::RequestModelStream(int32 chIdx) {
         ch.modelIds[j] = MODEL_INVALID;
     }
 
-    CdStreamRead(chIdx, ms_pStreamingBuffer[chIdx], pos, numSectorsToRead); // Request models to be read
+    // NOTSA: If enabled, copy the models out of the memory-mapped IMG right away, instead of having the stream thread read them
+    if (!g_StreamingConfig.MapImgFiles) {
+        CdStreamUnmapImages(); // Option may have been turned off since
+    }
+    if (!g_StreamingConfig.MapImgFiles || !CdStreamReadMapped(chIdx, ms_pStreamingBuffer[chIdx], pos, numSectorsToRead)) {
+        CdStreamRead(chIdx, ms_pStreamingBuffer[chIdx], pos, numSectorsToRead); // Request models to be read
+    }
     ch.LoadStatus   = eChannelState::READING;
     ch.loadingLevel = 0;
     ch.sectorCount  = numSectorsToRead; // Set how many sectors to read
@@ -2860,6 +2960,7 @@ void CStreaming::Init2() {
     };
     InitList(ms_startLoadedList,     ms_pEndLoadedList,    RESOURCE_ID_LOADED_LIST_START,  RESOURCE_ID_LOADED_LIST_END );
     InitList(ms_pStartRequestedList, ms_pEndRequestedList, RESOURCE_ID_REQUEST_LIST_START, RESOURCE_ID_REQUEST_LIST_END);
+    ClearRequestQueue(); // NOTSA
 
     ms_oldSectorX = 0; // *
     ms_oldSectorY = 0; // * * leftover (see III/VC DeleteFarAwayRwObjects)
@@ -23,6 +23,63 @@ CZone (&CTheZones::MapZoneArray)[39] = *(CZone(*)[39])0xBA1908;
 
 int16& CTheZones::TotalNumberOfZoneInfos = *(int16*)0xBA1DE8;
 
+// NOTSA: Uniform 2D grid over the navigation zones, so `FindSmallestZoneForPosition` only has to check the zones overlapping the point's cell
+// Each cell has the indices of the zones overlapping it in ascending order (So the zones are checked in the same order as the linear scan)
+// The grid covers the bounding box of the zones, and is rebuilt (lazily) whenever zones are created/loaded (See `InvalidateNavigationZoneGrid`)
+static constexpr int32 ZONE_GRID_NUM_CELLS = 24; // Per axis
+
+static std::array<std::vector<int16>, ZONE_GRID_NUM_CELLS * ZONE_GRID_NUM_CELLS> s_NavigationZoneGrid{};
+static CVector2D                                                                s_NavigationZoneGridMin{}, s_NavigationZoneGridCellSize{};
+static bool                                                                     s_NavigationZoneGridIsDirty{true};
+static int16                                                                    s_NumNavigationZonesInGrid{-1}; // Zones may be created by unhooked code too, in which case the count changes
+
+// NOTSA
+void CTheZones::BuildNavigationZoneGrid() {
+    ZoneScoped;
+
+    for (auto& cell : s_NavigationZoneGrid) {
+        cell.clear();
+    }
+    s_NavigationZoneGridIsDirty = false;
+    s_NumNavigationZonesInGrid  = TotalNumberOfNavigationZones;
+
+    const auto zones = GetNavigationZones();
+    if (zones.empty()) {
+        s_NavigationZoneGridCellSize = {}; // So no point is inside
+        return;
+    }
+
+    // 1 unit of margin so points on the borders (or rounded onto them) are always covered
+    CVector2D min{ FLT_MAX, FLT_MAX }, max{ -FLT_MAX, -FLT_MAX };
+    for (const auto& z : zones) {
+        min = CVector2D{ std::min(min.x, (float)z.m_fX1 - 1.f), std::min(min.y, (float)z.m_fY1 - 1.f) };
+        max = CVector2D{ std::max(max.x, (float)z.m_fX2 + 1.f), std::max(max.y, (float)z.m_fY2 + 1.f) };
+    }
+    s_NavigationZoneGridMin      = min;
+    s_NavigationZoneGridCellSize = (max - min) / (float)ZONE_GRID_NUM_CELLS;
+
+    const auto GetCellRange = [](float min, float max, float gridMin, float cellSize) {
+        return std::make_pair(
+            std::clamp((int32)std::floor((min - 1.f - gridMin) / cellSize), 0, ZONE_GRID_NUM_CELLS - 1),
+            std::clamp((int32)std::floor((max + 1.f - gridMin) / cellSize), 0, ZONE_GRID_NUM_CELLS - 1)
+        );
+    };
+    for (auto&& [i, z] : rngv::enumerate(zones)) {
+        const auto [x1, x2] = GetCellRange(z.m_fX1, z.m_fX2, s_NavigationZoneGridMin.x, s_NavigationZoneGridCellSize.x);
+        const auto [y1, y2] = GetCellRange(z.m_fY1, z.m_fY2, s_NavigationZoneGridMin.y, s_NavigationZoneGridCellSize.y);
+        for (auto y = y1; y <= y2; y++) {
+            for (auto x = x1; x <= x2; x++) {
+                s_NavigationZoneGrid[y * ZONE_GRID_NUM_CELLS + x].push_back((int16)i);
+            }
+        }
+    }
+}
+
+// NOTSA
+void CTheZones::InvalidateNavigationZoneGrid() {
+    s_NavigationZoneGridIsDirty = true;
+}
+
 void CTheZones::InjectHooks() {
     RH_ScopedClass(CTheZones);
     RH_ScopedCategoryGlobal();
@@ -143,18 +200,34 @@ CZone* CTheZones::FindSmallestZoneForPosition(const CVector& point, bool checkIs
 
     auto smallestZone     = &NavigationZoneArray[0]; // Start with the whole map
     auto smallestZoneSize = GetZoneSize(smallestZone); 
-    for (auto& z : GetNavigationZones()) {
+    const auto CheckZone = [&](CZone& z) {
         if (checkIsNavi && z.m_nType != ZONE_TYPE_NAVI) {
-            continue;
+            return;
         }
         if (!z.GetBB().IsPointInside(point)) {
-            continue;
+            return;
         }
         const auto zsize = GetZoneSize(&z);
         if (zsize < smallestZoneSize) {
             smallestZone     = &z;
             smallestZoneSize = zsize;
         }
+    };
+
+    // NOTSA: Use the grid (Zones may be created after `PostZoneCreation` (Eg.: By mods), so rebuild it if necessary)
+    if (s_NavigationZoneGridIsDirty || s_NumNavigationZonesInGrid != TotalNumberOfNavigationZones) {
+        BuildNavigationZoneGrid();
+    }
+    const auto cx = s_NavigationZoneGridCellSize.x > 0.f ? (int32)std::floor((point.x - s_NavigationZoneGridMin.x) / s_NavigationZoneGridCellSize.x) : -1,
+               cy = s_NavigationZoneGridCellSize.y > 0.f ? (int32)std::floor((point.y - s_NavigationZoneGridMin.y) / s_NavigationZoneGridCellSize.y) : -1;
+    if (cx >= 0 && cx < ZONE_GRID_NUM_CELLS && cy >= 0 && cy < ZONE_GRID_NUM_CELLS) {
+        for (const auto i : s_NavigationZoneGrid[cy * ZONE_GRID_NUM_CELLS + cx]) {
+            CheckZone(NavigationZoneArray[i]);
+        }
+    } else { // Outside of the grid, do it the original way
+        for (auto& z : GetNavigationZones()) {
+            CheckZone(z);
+        }
     }
     return smallestZone;
 }
@@ -244,6 +317,7 @@ void CTheZones::Init() {
     TotalNumberOfNavigationZones = 0;
     TotalNumberOfMapZones        = 0;
     m_CurrLevel                  = LEVEL_NAME_COUNTRY_SIDE;
+    InvalidateNavigationZoneGrid(); // NOTSA
 
     CreateZone("SAN_AND", ZONE_TYPE_NAVI, { -3000.f, -3000.f, -2000.f }, { 3000.f, 3000.f, 2000.f }, LEVEL_NAME_COUNTRY_SIDE, "SAN_AND");
     CreateZone("THEMAP", ZONE_TYPE_MAP, { -3000.f, -3000.f, -2000.f }, { 3000.f, 3000.f, 2000.f }, LEVEL_NAME_COUNTRY_SIDE, "THEMAP");
@@ -297,6 +371,7 @@ void CTheZones::CreateZone(
     case ZONE_TYPE_LOCAL_NAVI:
     case ZONE_TYPE_NAVI:
         AssignZoneInfoForThisZone(TotalNumberOfNavigationZones - 1);
+        InvalidateNavigationZoneGrid(); // NOTSA
         break;
     }
 }
@@ -421,12 +496,16 @@ void CTheZones::Load() {
     }
     CGenericGameStorage::LoadDataFromWorkBuffer(ZonesVisited);
     CGenericGameStorage::LoadDataFromWorkBuffer(ZonesRevealed);
+
+    InvalidateNavigationZoneGrid(); // NOTSA
 }
 
 // dummy function
 // 0x572B70
 void CTheZones::PostZoneCreation() {
     // NOP
+
+    BuildNavigationZoneGrid(); // NOTSA
 }
 
 const GxtChar* CTheZones::GetZoneName(const CVector& point) {
@@ -63,6 +63,12 @@ public:
     static void Load();
     static void PostZoneCreation();
 
+    //! NOTSA: Build the grid used by `FindSmallestZoneForPosition` (Done automatically after `InvalidateNavigationZoneGrid`)
+    static void BuildNavigationZoneGrid();
+
+    //! NOTSA: Have the grid used by `FindSmallestZoneForPosition` rebuilt - Must be called whenever the navigation zones are written
+    static void InvalidateNavigationZoneGrid();
+
     // NOTSA
     static const GxtChar* GetZoneName(const CVector& point);
 
@@ -260,7 +260,7 @@ void CTimeCycle::CalcColoursForPoint(CVector point, CColourSet* set) {
 
     int boxHour, boxWeather;
     if (weatherBox) {
-        boxHour = weatherBox->m_ExtraColor % 8;
+        boxHour = weatherBox->m_ExtraColor % NUM_HOURS;
         boxWeather = (weatherBox->m_ExtraColor / NUM_HOURS) + 21;
     }
 
@@ -332,6 +332,36 @@ void CTimeCycle::CalcColoursForPoint(CVector point, CColourSet* set) {
         set->m_nSkyBottomGreen = uint16((float)set->m_nSkyBottomGreen * invboxf + (float)m_nSkyBottomGreen[boxHour][boxWeather] * boxf);
         set->m_nSkyBottomBlue  = uint16((float)set->m_nSkyBottomBlue  * invboxf + (float)m_nSkyBottomBlue[boxHour][boxWeather] * boxf);
 
+#ifdef FIX_BUGS // 0x560AAE: Originally `*=`, which multiplies the colour by the whole blended value, instead of blending it
+        set->m_fWaterRed   = set->m_fWaterRed   * invboxf + (float)m_fWaterRed[boxHour][boxWeather] * boxf;
+        set->m_fWaterGreen = set->m_fWaterGreen * invboxf + (float)m_fWaterGreen[boxHour][boxWeather] * boxf;
+        set->m_fWaterBlue  = set->m_fWaterBlue  * invboxf + (float)m_fWaterBlue[boxHour][boxWeather] * boxf;
+        set->m_fWaterAlpha = set->m_fWaterAlpha * invboxf + (float)m_fWaterAlpha[boxHour][boxWeather] * boxf;
+
+        set->m_fAmbientRed   = set->m_fAmbientRed   * invboxf + (float)m_nAmbientRed[boxHour][boxWeather] * boxf;
+        set->m_fAmbientGreen = set->m_fAmbientGreen * invboxf + (float)m_nAmbientGreen[boxHour][boxWeather] * boxf;
+        set->m_fAmbientBlue  = set->m_fAmbientBlue  * invboxf + (float)m_nAmbientBlue[boxHour][boxWeather] * boxf;
+
+        set->m_fAmbientRed_Obj   = set->m_fAmbientRed_Obj   * invboxf + (float)m_nAmbientRed_Obj[boxHour][boxWeather] * boxf;
+        set->m_fAmbientGreen_Obj = set->m_fAmbientGreen_Obj * invboxf + (float)m_nAmbientGreen_Obj[boxHour][boxWeather] * boxf;
+        set->m_fAmbientBlue_Obj  = set->m_fAmbientBlue_Obj  * invboxf + (float)m_nAmbientBlue_Obj[boxHour][boxWeather] * boxf;
+
+        if ((float)m_fFarClip[boxHour][boxWeather] < set->m_fFarClip) {
+            set->m_fFarClip = set->m_fFarClip * invboxf + (float)m_fFarClip[boxHour][boxWeather] * boxf;
+        }
+
+        set->m_fFogStart = set->m_fFogStart * invboxf + (float)m_fFogStart[boxHour][boxWeather] * boxf;
+
+        set->m_fPostFx1Red   = set->m_fPostFx1Red   * invboxf + (float)m_fPostFx1Red[boxHour][boxWeather] * boxf;
+        set->m_fPostFx1Green = set->m_fPostFx1Green * invboxf + (float)m_fPostFx1Green[boxHour][boxWeather] * boxf;
+        set->m_fPostFx1Blue  = set->m_fPostFx1Blue  * invboxf + (float)m_fPostFx1Blue[boxHour][boxWeather] * boxf;
+        set->m_fPostFx1Alpha = set->m_fPostFx1Alpha * invboxf + (float)m_fPostFx1Alpha[boxHour][boxWeather] * boxf;
+
+        set->m_fPostFx2Red   = set->m_fPostFx2Red   * invboxf + (float)m_fPostFx2Red[boxHour][boxWeather] * boxf;
+        set->m_fPostFx2Green = set->m_fPostFx2Green * invboxf + (float)m_fPostFx2Green[boxHour][boxWeather] * boxf;
+        set->m_fPostFx2Blue  = set->m_fPostFx2Blue  * invboxf + (float)m_fPostFx2Blue[boxHour][boxWeather] * boxf;
+        set->m_fPostFx2Alpha = set->m_fPostFx2Alpha * invboxf + (float)m_fPostFx2Alpha[boxHour][boxWeather] * boxf;
+#else
         set->m_fWaterRed   *= invboxf + (float)m_fWaterRed[boxHour][boxWeather] * boxf;
         set->m_fWaterGreen *= invboxf + (float)m_fWaterGreen[boxHour][boxWeather] * boxf;
         set->m_fWaterBlue  *= invboxf + (float)m_fWaterBlue[boxHour][boxWeather] * boxf;
@@ -360,6 +390,7 @@ void CTimeCycle::CalcColoursForPoint(CVector point, CColourSet* set) {
         set->m_fPostFx2Green *= invboxf + (float)m_fPostFx2Green[boxHour][boxWeather] * boxf;
         set->m_fPostFx2Blue  *= invboxf + (float)m_fPostFx2Blue[boxHour][boxWeather] * boxf;
         set->m_fPostFx2Alpha *= invboxf + (float)m_fPostFx2Alpha[boxHour][boxWeather] * boxf;
+#endif
     }
 
     if (lodBox) {
@@ -528,15 +559,100 @@ float CTimeCycle::FindFarClipForCoors(CVector cameraPos) {
     return set.m_fFarClip;
 }
 
+// NOTSA
+void CTimeCycle::CalcColoursForPoints(std::span<const CVector> points, std::span<CColourSet> outSets) {
+    assert(outSets.size() >= points.size());
+
+    // `CalcColoursForPoint` advances the stored sun/shadow values and fades the
+    // extra colour/fog reduction, none of which should happen more than once a frame
+    // It overwrites the sun/shadow values at the next stored value's index, so save those too
+    const auto storedValue      = m_CurrentStoredValue;
+    const auto nextStoredValue  = (storedValue + 1) & 15;
+    const auto vectorToSun      = m_VectorToSun[nextStoredValue];
+    const auto shadowFront      = CVector2D{ m_fShadowFrontX[nextStoredValue], m_fShadowFrontY[nextStoredValue] };
+    const auto shadowSide       = CVector2D{ m_fShadowSideX[nextStoredValue], m_fShadowSideY[nextStoredValue] };
+    const auto shadowDisp       = CVector2D{ m_fShadowDisplacementX[nextStoredValue], m_fShadowDisplacementY[nextStoredValue] };
+    const auto fogReduction     = m_FogReduction;
+    const auto extraColourInter = m_ExtraColourInter;
+    const auto belowHorizonGrey = m_BelowHorizonGrey;
+    const auto brightnessAdded  = CVector{ m_BrightnessAddedToAmbientRed, m_BrightnessAddedToAmbientGreen, m_BrightnessAddedToAmbientBlue };
+    const auto currentColours   = m_CurrentColours; // Modified by `SetConstantParametersForPostFX`
+
+    for (auto i = 0u; i < points.size(); i++) {
+        m_CurrentStoredValue = storedValue;
+        m_FogReduction       = fogReduction;
+        m_ExtraColourInter   = extraColourInter;
+        CalcColoursForPoint(points[i], &outSets[i]);
+    }
+
+    m_CurrentStoredValue                    = storedValue;
+    m_VectorToSun[nextStoredValue]          = vectorToSun;
+    m_fShadowFrontX[nextStoredValue]        = shadowFront.x;
+    m_fShadowFrontY[nextStoredValue]        = shadowFront.y;
+    m_fShadowSideX[nextStoredValue]         = shadowSide.x;
+    m_fShadowSideY[nextStoredValue]         = shadowSide.y;
+    m_fShadowDisplacementX[nextStoredValue] = shadowDisp.x;
+    m_fShadowDisplacementY[nextStoredValue] = shadowDisp.y;
+    m_FogReduction                          = fogReduction;
+    m_ExtraColourInter                      = extraColourInter;
+    m_BelowHorizonGrey                      = belowHorizonGrey;
+    m_BrightnessAddedToAmbientRed           = brightnessAdded.x;
+    m_BrightnessAddedToAmbientGreen         = brightnessAdded.y;
+    m_BrightnessAddedToAmbientBlue          = brightnessAdded.z;
+    m_CurrentColours                        = currentColours;
+}
+
 // 0x55FFD0
 void CTimeCycle::FindTimeCycleBox(CVector pos, CTimeCycleBox** outBox, float* interpolation, bool bCheckLod, bool bCheckFar, CTimeCycleBox* exclude) {
     return plugin::Call<0x55FFD0, CVector, CTimeCycleBox**, float*, bool, bool, CTimeCycleBox*>(pos, outBox, interpolation, bCheckLod, bCheckFar, exclude);
 
+    // untested
     *outBox = nullptr;
     *interpolation = 0.0f;
 
-    for (auto& box : std::span{ m_aBoxes, m_NumBoxes }) {
+    for (auto& box : std::span{ m_aBoxes, (size_t)m_NumBoxes }) {
+        if (&box == exclude) {
+            continue;
+        }
+
+        // Only boxes that change what we're looking for
+        if (bCheckLod && box.m_LodDistMult == 32 // 1.0
+            || bCheckFar && box.m_FarClip == 0
+            || !bCheckLod && !bCheckFar && box.m_ExtraColor < 0
+        ) {
+            continue;
+        }
 
+        // The box's effect fades out over `m_Falloff` units around it (Only a third of it on the Z axis)
+        const auto& bb = box.m_Box;
+        if (   pos.x < bb.m_vecMin.x - box.m_Falloff
+            || pos.y < bb.m_vecMin.y - box.m_Falloff
+            || pos.z < bb.m_vecMin.z - box.m_Falloff / 3.0f
+            || pos.x > bb.m_vecMax.x + box.m_Falloff
+            || pos.y > bb.m_vecMax.y + box.m_Falloff
+            || pos.z > bb.m_vecMax.z + box.m_Falloff / 3.0f
+        ) {
+            continue;
+        }
+
+        if (bb.IsPointInside(pos)) {
+            *outBox = &box;
+            *interpolation = 1.0f;
+            return;
+        }
+
+        float dist = 0.0f;
+        if (pos.x < bb.m_vecMin.x) dist = std::max(dist, bb.m_vecMin.x - pos.x);
+        if (pos.x > bb.m_vecMax.x) dist = std::max(dist, pos.x - bb.m_vecMax.x);
+        if (pos.y < bb.m_vecMin.y) dist = std::max(dist, bb.m_vecMin.y - pos.y);
+        if (pos.y > bb.m_vecMax.y) dist = std::max(dist, pos.y - bb.m_vecMax.y);
+        if (pos.z < bb.m_vecMin.z) dist = std::max(dist, (bb.m_vecMin.z - pos.z) * 3.0f);
+        if (pos.z > bb.m_vecMax.z) dist = std::max(dist, (pos.z - bb.m_vecMax.z) * 3.0f);
+
+        if (const auto interp = 1.0f - dist / box.m_Falloff; interp > *interpolation) {
+            *outBox = &box;
+            *interpolation = interp;
+        }
     }
 }
 
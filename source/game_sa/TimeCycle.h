@@ -143,6 +143,14 @@ public:
     static void CalcColoursForPoint(CVector point, CColourSet* set);
     static float FindFarClipForCoors(CVector cameraPos);
     static void FindTimeCycleBox(CVector pos, CTimeCycleBox** outBox, float* interpolation, bool bCheckLod, bool bCheckFar, CTimeCycleBox* exclude);
+
+    /*!
+    * @brief NOTSA - Calculate the colour sets of many points (Eg.: For mirrors/reflections)
+    * @brief This is just a convenience wrapper: Each point is evaluated by `CalcColoursForPoint` (including the hour/weather interpolation), so it's no faster than calling that for each point.
+    * @brief Unlike `CalcColoursForPoint` the current frame's timecycle state (stored sun/shadow values, extra colour fade, fog reduction, etc) is left untouched
+    * @param outSets Colour set of each point, must be at least as big as `points`
+    */
+    static void CalcColoursForPoints(std::span<const CVector> points, std::span<CColourSet> outSets);
     static void SetConstantParametersForPostFX();
 
     static float GetAmbientRed()                    { return gfLaRiotsLightMult * m_CurrentColours.m_fAmbientRed; }       // 0x560330
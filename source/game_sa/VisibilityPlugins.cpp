@@ -172,7 +172,7 @@ bool CVisibilityPlugins::InsertEntityIntoEntityList(CEntity* entity, float dista
     info.m_entity = entity;
     info.m_pCallback = callback;
     info.m_distance = distance;
-    return m_alphaEntityList.InsertSorted(info);
+    return m_alphaEntityList.InsertDeferredSorted(info);
 }
 
 // 0x733D90
@@ -182,7 +182,7 @@ bool CVisibilityPlugins::InsertEntityIntoUnderwaterEntities(CEntity* entity, flo
     info.m_distance = distance;
     info.m_entity = entity;
     info.m_pCallback = RenderEntity;
-    return m_alphaUnderwaterEntityList.InsertSorted(info);
+    return m_alphaUnderwaterEntityList.InsertDeferredSorted(info);
 }
 
 // 0x733E10
@@ -191,7 +191,7 @@ bool CVisibilityPlugins::InsertAtomicIntoReallyDrawLastList(RpAtomic* atomic, fl
     info.m_distance = distance;
     info.m_atomic = atomic;
     info.m_pCallback = DefaultAtomicRenderCallback;
-    return m_alphaReallyDrawLastList.InsertSorted(info);
+    return m_alphaReallyDrawLastList.InsertDeferredSorted(info);
 }
 
 // 0x733E50
@@ -200,7 +200,7 @@ bool CVisibilityPlugins::InsertEntityIntoReallyDrawLastList(CEntity* entity, flo
     info.m_distance = distance;
     info.m_entity = entity;
     info.m_pCallback = RenderEntity;
-    return m_alphaReallyDrawLastList.InsertSorted(info);
+    return m_alphaReallyDrawLastList.InsertDeferredSorted(info);
 }
 
 // todo: Add MI_GASSTATION (see Android)
@@ -624,7 +624,7 @@ RpAtomic* CVisibilityPlugins::RenderHeliRotorAlphaCB(RpAtomic* atomic) {
     objectInfo.m_atomic = atomic;
     objectInfo.m_pCallback = DefaultAtomicRenderCallback;
     objectInfo.m_distance = dotProduct * MAX_FADING_DISTANCE + gVehicleDistanceFromCamera;
-    if (!m_alphaList.InsertSorted(objectInfo)) {
+    if (!m_alphaList.InsertDeferredSorted(objectInfo)) {
         AtomicDefaultRenderCallBack(atomic);
     }
     return atomic;
@@ -644,7 +644,7 @@ RpAtomic* CVisibilityPlugins::RenderHeliTailRotorAlphaCB(RpAtomic* atomic) {
     info.m_atomic = atomic;
     info.m_pCallback = DefaultAtomicRenderCallback;
     info.m_distance = -dotProduct1 - dotProduct2 + gVehicleDistanceFromCamera;
-    if (!m_alphaList.InsertSorted(info))
+    if (!m_alphaList.InsertDeferredSorted(info))
         AtomicDefaultRenderCallBack(atomic);
     return atomic;
 }
@@ -663,6 +663,8 @@ RpAtomic* CVisibilityPlugins::RenderObjNormalAtomic(RpAtomic* atomic) {
 
 // 0x7337A0
 void CVisibilityPlugins::RenderOrderedList(CLinkList<CVisibilityPlugins::AlphaObjectInfo>& alphaObjectInfoList) {
+    alphaObjectInfoList.SortByDistance(); // NOTSA: Entries are inserted using `InsertDeferredSorted`, so sort them once here
+
     auto link = alphaObjectInfoList.usedListTail.prev;
     for (; link != &alphaObjectInfoList.usedListHead; link = link->prev) {
         auto callBack = reinterpret_cast<tAlphaRenderOrderedListCB>(link->data.m_pCallback);
@@ -750,7 +752,7 @@ RpAtomic* CVisibilityPlugins::RenderTrainHiDetailAlphaCB(RpAtomic* atomic) {
         info.m_distance = gVehicleDistanceFromCamera;
     else
         info.m_distance = gVehicleDistanceFromCamera + dot;
-    if (!m_alphaList.InsertSorted(info))
+    if (!m_alphaList.InsertDeferredSorted(info))
         AtomicDefaultRenderCallBack(atomic);
 
     return atomic;
@@ -810,7 +812,7 @@ RpAtomic* CVisibilityPlugins::RenderVehicleHiDetailAlphaCB(RpAtomic* atomic) {
         info.m_distance = gVehicleDistanceFromCamera - 0.0001f;
     else
         info.m_distance = gVehicleDistanceFromCamera + dot;
-    if (!m_alphaList.InsertSorted(info))
+    if (!m_alphaList.InsertDeferredSorted(info))
         AtomicDefaultRenderCallBack(atomic);
 
     return atomic;
@@ -845,7 +847,7 @@ RpAtomic* CVisibilityPlugins::RenderVehicleHiDetailAlphaCB_BigVehicle(RpAtomic*
         info.m_distance = gVehicleDistanceFromCamera - 0.0001f;
     else
         info.m_distance = gVehicleDistanceFromCamera + dot;
-    if (!m_alphaList.InsertSorted(info))
+    if (!m_alphaList.InsertDeferredSorted(info))
         AtomicDefaultRenderCallBack(atomic);
 
     return atomic;
@@ -867,7 +869,7 @@ RpAtomic* CVisibilityPlugins::RenderVehicleHiDetailAlphaCB_Boat(RpAtomic* atomic
         info.m_distance = gVehicleDistanceFromCamera;
         info.m_atomic = atomic;
         info.m_pCallback = DefaultAtomicRenderCallback;
-        if (m_alphaBoatAtomicList.InsertSorted(info))
+        if (m_alphaBoatAtomicList.InsertDeferredSorted(info))
             return atomic;
     }
     AtomicDefaultRenderCallBack(atomic);
@@ -16,6 +16,8 @@
 #include "CustomBuildingDNPipeline.h"
 #include "VehicleRecording.h"
 #include "Garages.h"
+#include "SectorBuildingArray.h"
+#include "extensions/Configs/Animation.hpp"
 
 int32& CWorld::ms_iProcessLineNumCrossings = *(int32*)0xB7CD60;
 float& CWorld::fWeaponSpreadRate = *(float*)0xB7CD64;
@@ -622,6 +624,7 @@ void CWorld::ShutDown() {
 
     ms_listMovingEntityPtrs.Flush();
     ms_listObjectsWithControlCode.Flush();
+    notsa::SectorBuildingArray::InvalidateAll(); // NOTSA
 
     for (auto& player : Players) {
         player.m_PlayerData.DeAllocateData();
@@ -771,8 +774,11 @@ void CWorld::FindObjectsInRange(const CVector& point, float radius, bool b2D, in
             auto sector = GetSector(x, y);
             auto repeatSector = GetRepeatSector(x, y);
 
-            if (buildings)
-                ProcessSector(sector->m_buildings);
+            if (buildings) {
+                // NOTSA: Only go through the buildings in range (The rest would be skipped anyways)
+                auto inRange = notsa::SectorBuildingArray::Get(*sector).GetBuildingsInRange(point, radius, b2D);
+                ProcessSector(inRange);
+            }
             if (vehicles)
                 ProcessSector(repeatSector->Vehicles);
             if (peds)
@@ -1477,8 +1483,13 @@ CPed* CWorld::FindUnsuspectingTargetPed(CVector point, CVector playerPosn) {
 // 0x566EE0
 template<typename PtrListType>
 bool CWorld::ProcessLineOfSightSectorList(PtrListType& ptrList, const CColLine& colLine, CColPoint& outColPoint, float& minTouchDistance, CEntity*& outEntity, bool doSeeThroughCheck, bool doIgnoreCameraCheck, bool doShootThroughCheck) {
-    if (!ptrList.m_node)
-        return false;
+    if constexpr (requires { ptrList.m_node; }) {
+        if (!ptrList.m_node)
+            return false;
+    } else { // NOTSA: A span of entities (See `ProcessLineOfSightSector`)
+        if (ptrList.empty())
+            return false;
+    }
 
     float localMinTouchDist = minTouchDistance;
 
@@ -1939,11 +1950,23 @@ void CWorld::Process() {
         return;
     }
 
-    IterateMovingList([&](CEntity* entity) {
-        if (!entity->m_bRemoveFromWorld) {
-            entity->UpdateAnim();
-        }
-    });
+    if (g_AnimationConfig.ParallelClumpUpdate) { // NOTSA
+        static std::vector<RpAnimBlendClumpUpdateArgs> s_AnimUpdates{};
+        s_AnimUpdates.clear();
+        IterateMovingList([&](CEntity* entity) {
+            RpAnimBlendClumpUpdateArgs args;
+            if (!entity->m_bRemoveFromWorld && entity->GetAnimUpdateArgs(args)) {
+                s_AnimUpdates.emplace_back(args);
+            }
+        });
+        RpAnimBlendClumpUpdateAnimationsParallel(s_AnimUpdates);
+    } else {
+        IterateMovingList([&](CEntity* entity) {
+            if (!entity->m_bRemoveFromWorld) {
+                entity->UpdateAnim();
+            }
+        });
+    }
 
     // Process moving entities (And possibly remove them from the world)
     {
@@ -2113,7 +2136,12 @@ bool CWorld::GetIsLineOfSightSectorClear(CSector& sector, CRepeatSector& repeatS
     const auto ProcessSectorList = [&]<typename PtrListType>(PtrListType& list, bool doIgnoreCamCheckForThisSector) {
         return GetIsLineOfSightSectorListClear(list, colLine, doSeeThroughCheck, doIgnoreCamCheckForThisSector);
     };
-    return   (!buildings || ProcessSectorList(sector.m_buildings, false))
+    const auto ProcessBuildings = [&] {
+        // NOTSA: Only go through the buildings whose bounds the line touches (The rest would be rejected by `CCollision::TestLineOfSight` anyways)
+        auto touching = notsa::SectorBuildingArray::Get(sector).GetBuildingsTouchingLine(colLine);
+        return ProcessSectorList(touching, false);
+    };
+    return   (!buildings || ProcessBuildings())
           && (!vehicles  || ProcessSectorList(repeatSector.Vehicles, false))
           && (!peds      || ProcessSectorList(repeatSector.Peds, false))
           && (!objects   || ProcessSectorList(repeatSector.Objects, doIgnoreCameraCheck))
@@ -2685,8 +2713,11 @@ bool CWorld::ProcessLineOfSightSector(CSector& sector, CRepeatSector& repeatSect
         ProcessLineOfSightSectorList(list, colLine, outColPoint, localMaxTouchDist, outEntity, doSeeThroughCheck, doIgnoreCameraCheckForThisSector, doShootThroughCheck);
     };
 
-    if (buildings)
-        ProcessSector(sector.m_buildings);
+    if (buildings) {
+        // NOTSA: Only go through the buildings whose bounds the line touches (The rest would be rejected by `CCollision::ProcessLineOfSight` anyways)
+        auto touching = notsa::SectorBuildingArray::Get(sector).GetBuildingsTouchingLine(colLine);
+        ProcessSector(touching);
+    }
 
     if (fWeaponSpreadRate_Original > 0.f)
         fWeaponSpreadRate = fWeaponSpreadRate_Original;
@@ -2913,6 +2944,48 @@ bool CWorld::ProcessLineOfSight(const CVector& origin, const CVector& target, CC
     //return touchDist < 1.f;
 }
 
+// NOTSA
+// Get the indices of the lines ordered by the sector they start in.
+// Processing lines starting in the same sector after each other keeps that sector's data (eg.: `notsa::SectorBuildingArray`) in the cache.
+// The order doesn't change the results, as every line is processed with a new scan code anyways.
+static std::span<const std::pair<int32, size_t>> GetLinesInSectorOrder(std::span<const CColLine> lines) {
+    static std::vector<std::pair<int32, size_t>> s_Order{}; // Sector index, line index
+    s_Order.clear();
+    for (auto&& [i, line] : rngv::enumerate(lines)) {
+        s_Order.emplace_back(CWorld::GetSectorY(line.m_vecStart.y) * MAX_SECTORS_X + CWorld::GetSectorX(line.m_vecStart.x), (size_t)i);
+    }
+    rng::sort(s_Order);
+    return s_Order;
+}
+
+// NOTSA
+size_t CWorld::ProcessLinesOfSight(std::span<const CColLine> lines, std::span<CColPoint> outColPoints, std::span<CEntity*> outEntities, bool buildings, bool vehicles, bool peds, bool objects, bool dummies, bool doSeeThroughCheck, bool doCameraIgnoreCheck, bool doShootThroughCheck) {
+    assert(outColPoints.size() >= lines.size() && outEntities.size() >= lines.size());
+
+    size_t numHits{};
+    for (const auto& [sectorIdx, i] : GetLinesInSectorOrder(lines)) {
+        const auto& line = lines[i];
+        if (ProcessLineOfSight(line.m_vecStart, line.m_vecEnd, outColPoints[i], outEntities[i], buildings, vehicles, peds, objects, dummies, doSeeThroughCheck, doCameraIgnoreCheck, doShootThroughCheck)) {
+            numHits++;
+        }
+    }
+    return numHits;
+}
+
+// NOTSA
+size_t CWorld::GetAreLinesOfSightClear(std::span<const CColLine> lines, std::span<bool> outIsClear, bool buildings, bool vehicles, bool peds, bool objects, bool dummies, bool doSeeThroughCheck, bool doCameraIgnoreCheck) {
+    assert(outIsClear.size() >= lines.size());
+
+    size_t numClear{};
+    for (const auto& [sectorIdx, i] : GetLinesInSectorOrder(lines)) {
+        const auto& line = lines[i];
+        if ((outIsClear[i] = GetIsLineOfSightClear(line.m_vecStart, line.m_vecEnd, buildings, vehicles, peds, objects, dummies, doSeeThroughCheck, doCameraIgnoreCheck))) {
+            numClear++;
+        }
+    }
+    return numClear;
+}
+
 // 0x4072E0
 void CWorld::IncrementCurrentScanCode() {
     if (ms_nCurrentScanCode >= 65535u) {
@@ -252,6 +252,32 @@ public:
 
     static void RemoveVehicleAndItsOccupants(CVehicle* veh);
 
+    /*!
+    * @notsa
+    *
+    * @brief Same as calling `ProcessLineOfSight` for each line, but the lines are processed grouped by the sector they start in (so that sector's data is still in the cache)
+    * @brief The lines don't share any other work, each one is still processed on it's own.
+    *
+    * @param lines        The lines to process
+    * @param outColPoints Closest col. point of the line of the same index (Only set if the line hit something)
+    * @param outEntities  Entity hit by the line of the same index (Or `nullptr` if it hit nothing)
+    *
+    * @return The number of lines that hit something
+    */
+    static size_t ProcessLinesOfSight(std::span<const CColLine> lines, std::span<CColPoint> outColPoints, std::span<CEntity*> outEntities, bool buildings, bool vehicles, bool peds, bool objects, bool dummies, bool doSeeThroughCheck, bool doCameraIgnoreCheck, bool doShootThroughCheck);
+
+    /*!
+    * @notsa
+    *
+    * @brief Same as calling `GetIsLineOfSightClear` for each line, but the lines are processed grouped by the sector they start in (See `ProcessLinesOfSight`)
+    *
+    * @param lines      The lines to check
+    * @param outIsClear Whether the line of the same index is clear
+    *
+    * @return The number of clear lines
+    */
+    static size_t GetAreLinesOfSightClear(std::span<const CColLine> lines, std::span<bool> outIsClear, bool buildings, bool vehicles, bool peds, bool objects, bool dummies = false, bool doSeeThroughCheck = false, bool doCameraIgnoreCheck = false);
+
     /*!
     * @notsa
     * 
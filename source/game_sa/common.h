@@ -260,6 +260,7 @@ bool GraphicsHighQuality();
 void WriteRaster(RwRaster* raster, const char* filename);
 bool CalcScreenCoors(const CVector& in, CVector& out, float& screenX, float& screenY);
 bool CalcScreenCoors(const CVector& in, CVector& out);
+float DistAlongPerpRightLine2D(CVector2D origin, CVector2D dir, CVector2D pt);
 bool DoesInfiniteLineTouchScreen(CVector2D origin, CVector2D dir);
 bool IsPointInsideLine(
     CVector2D origin,
@@ -26,6 +26,7 @@ struct ScriptCommand : Base {
 
         m_bIsHooked = !m_bIsHooked;
         CRunningScript::CustomCommandHandlerOf(m_cmd) = m_bIsHooked ? m_originalHandler : nullptr;
+        CRunningScript::UpdateCommandHandlerTable(m_cmd);
     }
 
     void        Check() override { /* nop */ }